@@ -0,0 +1,37 @@
+// libFuzzer target for map_import, build with `make fuzz` and run
+//   ./build/fuzz_import fuzz/corpus/import
+// every input that imports must survive export and import again
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "stb_ds.h"
+#include "map.h"
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    char *input = malloc(size + 1);
+    assert(input != NULL && "No RAM");
+    memcpy(input, data, size);
+    input[size] = '\0';
+
+    map_t map = { 0 };
+    map_init(&map);
+    map.max_threads = 1;
+    if (map_import(&map, input) == IMPORT_OK) {
+        char *exported = map_export(&map);
+        if (exported != NULL) {
+            map_t copy = { 0 };
+            map_init(&copy);
+            copy.max_threads = 1;
+            enum ImportError error = map_import(&copy, exported);
+            assert(error == IMPORT_OK && "Exported map doesn't import");
+            assert(map_checksum(&copy) == map_checksum(&map) && "Export changed the map");
+            map_free(&copy);
+            arrfree(exported);
+        }
+    }
+    map_free(&map);
+    free(input);
+    return 0;
+}
@@ -0,0 +1,30 @@
+// runs fuzz target once on every file given, so crashes and
+// corpus can be checked with any compiler, build with `make fuzz-replay`
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+int main(int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+        FILE *file = fopen(argv[i], "rb");
+        if (file == NULL) {
+            perror(argv[i]);
+            return 1;
+        }
+        fseek(file, 0, SEEK_END);
+        long size = ftell(file);
+        rewind(file);
+        uint8_t *data = malloc(size > 0 ? size : 1);
+        if (data == NULL || fread(data, 1, size, file) != (size_t)size) {
+            perror(argv[i]);
+            return 1;
+        }
+        fclose(file);
+        LLVMFuzzerTestOneInput(data, size);
+        free(data);
+        printf("%s: ok\n", argv[i]);
+    }
+    return 0;
+}
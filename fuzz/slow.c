@@ -0,0 +1,157 @@
+// libFuzzer target looking for maps that are slow to import or
+// simulate, build with `make fuzz` and run
+//   ./build/fuzz_slow -max_len=65536 fuzz/corpus/slow
+// instead of finding crashes it climbs towards worst cases: time,
+// events and memory per tick and time per imported byte are
+// bucketed by log2 into extra counters, so libFuzzer keeps every
+// input that reaches a new bucket, inputs reaching new worst bucket
+// are copied to $FUZZ_WORST_DIR (fuzz/corpus/worst by default, which
+// isn't tracked), good ones are moved by hand to fuzz/worst which is
+// used by --bench-worst
+#include <dirent.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <omp.h>
+
+#include "stb_ds.h"
+#include "map.h"
+
+#define FUZZ_TICKS 16
+#define METRIC_BUCKETS 64
+
+enum Metric {
+    // nanoseconds
+    METRIC_TICK_TIME,
+    METRIC_TICK_EVENTS,
+    // bytes of chunks and events
+    METRIC_TICK_MEMORY,
+    // picoseconds
+    METRIC_BYTE_TIME,
+    METRIC_COUNT,
+};
+
+static const char *metric_names[METRIC_COUNT] = {
+    [METRIC_TICK_TIME] = "tick_time",
+    [METRIC_TICK_EVENTS] = "tick_events",
+    [METRIC_TICK_MEMORY] = "tick_memory",
+    [METRIC_BYTE_TIME] = "byte_time",
+};
+
+// libFuzzer treats them as coverage
+__attribute__((used, section("__libfuzzer_extra_counters")))
+static uint8_t counters[METRIC_COUNT * METRIC_BUCKETS];
+// highest bucket reached so far, including by earlier runs
+static int worst[METRIC_COUNT];
+
+static const char* worst_dir(void) {
+    const char *dir = getenv("FUZZ_WORST_DIR");
+    return dir != NULL ? dir : "fuzz/corpus/worst";
+}
+
+// files saved by earlier runs are named <metric>-<bucket>,
+// so only inputs worse than all of them are saved again
+static void load_worst(void) {
+    DIR *dir = opendir(worst_dir());
+    if (dir == NULL) return;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        for (int metric = 0; metric < METRIC_COUNT; metric++) {
+            const size_t length = strlen(metric_names[metric]);
+            if (strncmp(entry->d_name, metric_names[metric], length) != 0 || entry->d_name[length] != '-') continue;
+            const int bucket = atoi(entry->d_name + length + 1);
+            if (bucket > worst[metric]) worst[metric] = bucket;
+        }
+    }
+    closedir(dir);
+}
+
+// creates every missing directory of path
+static bool make_dirs(const char *path) {
+    char dir[4096];
+    snprintf(dir, sizeof(dir), "%s", path);
+    for (char *slash = strchr(dir + 1, '/'); ; slash = strchr(slash + 1, '/')) {
+        if (slash != NULL) *slash = '\0';
+        if (mkdir(dir, 0755) != 0 && errno != EEXIST) {
+            perror(dir);
+            return false;
+        }
+        if (slash == NULL) return true;
+        *slash = '/';
+    }
+}
+
+static int log2_bucket(double value) {
+    int bucket = 0;
+    while (value >= 2 && bucket < METRIC_BUCKETS - 1) {
+        value /= 2;
+        bucket++;
+    }
+    return bucket;
+}
+
+static void save_worst(enum Metric metric, int bucket, const uint8_t *data, size_t size) {
+    const char *dir = worst_dir();
+    if (!make_dirs(dir)) return;
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/%s-%02d", dir, metric_names[metric], bucket);
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        perror(path);
+        return;
+    }
+    fwrite(data, 1, size, file);
+    fclose(file);
+}
+
+static void record(enum Metric metric, double value, const uint8_t *data, size_t size) {
+    const int bucket = log2_bucket(value);
+    counters[metric * METRIC_BUCKETS + bucket] = 1;
+    if (bucket > worst[metric]) {
+        worst[metric] = bucket;
+        save_worst(metric, bucket, data, size);
+    }
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    // replay doesn't call LLVMFuzzerInitialize, so it's done here
+    static bool loaded = false;
+    if (!loaded) {
+        load_worst();
+        loaded = true;
+    }
+    char *input = malloc(size + 1);
+    if (input == NULL) return 0;
+    memcpy(input, data, size);
+    input[size] = '\0';
+
+    map_t map = { 0 };
+    map_init(&map);
+    map.max_threads = 1;
+    double start = omp_get_wtime();
+    enum ImportError error = map_import(&map, input);
+    // rejected input stops early, it says nothing about slow imports
+    if (error == IMPORT_OK && size > 0) record(METRIC_BYTE_TIME, (omp_get_wtime() - start) * 1e12 / size, data, size);
+
+    if (error == IMPORT_OK) {
+        double tick_time = 0, tick_events = 0, tick_memory = 0;
+        for (int i = 0; i < FUZZ_TICKS; i++) {
+            start = omp_get_wtime();
+            map_update(&map);
+            const double elapsed = omp_get_wtime() - start;
+            const double memory = hmlenu(map.chunks) * sizeof(chunk_t) + map.stats.events * sizeof(queue_t);
+            if (elapsed > tick_time) tick_time = elapsed;
+            if (map.stats.events > tick_events) tick_events = map.stats.events;
+            if (memory > tick_memory) tick_memory = memory;
+        }
+        record(METRIC_TICK_TIME, tick_time * 1e9, data, size);
+        record(METRIC_TICK_EVENTS, tick_events, data, size);
+        record(METRIC_TICK_MEMORY, tick_memory, data, size);
+    }
+    map_free(&map);
+    free(input);
+    return 0;
+}
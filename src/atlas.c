@@ -0,0 +1,20 @@
+#include <stdbool.h>
+#include <raylib.h>
+
+#include "atlas.h"
+// generated by tools/atlas_embed.c
+#include "atlas_data.h"
+
+Image atlas_image(bool dark) {
+    return (Image){
+        .data = (void*)(dark ? atlas_dark : atlas_light),
+        .width = dark ? ATLAS_DARK_WIDTH : ATLAS_LIGHT_WIDTH,
+        .height = dark ? ATLAS_DARK_HEIGHT : ATLAS_LIGHT_HEIGHT,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+    };
+}
+
+Texture atlas_load(bool dark) {
+    return LoadTextureFromImage(atlas_image(dark));
+}
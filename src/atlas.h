@@ -0,0 +1,12 @@
+#ifndef ATLAS_H
+#define ATLAS_H
+#include <stdbool.h>
+#include <raylib.h>
+
+// atlases are decoded at build time and linked into the binary,
+// image points into it, so it must not be unloaded
+Image atlas_image(bool dark);
+// one upload straight from the binary, needs the window
+Texture atlas_load(bool dark);
+
+#endif // ATLAS_H
@@ -0,0 +1,337 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "stb_ds.h"
+#include "map.h"
+#include "autosave.h"
+
+#define AUTOSAVE_VERSION 2
+// file is compacted when it's this many times larger than live records
+#define AUTOSAVE_COMPACT_RATIO 2
+// and at least this large
+#define AUTOSAVE_COMPACT_MIN (1 << 20)
+
+// file starts with header, then goes any number of saves, every
+// save is chunk records followed by index of them, index points to
+// index of previous save, so the newest record of chunk is found by
+// walking indices from the one in header
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint16_t map_version;
+    // 0 if nothing was saved yet
+    uint64_t index_offset;
+} autosave_header_t;
+
+// followed by size bytes of encoded cells, empty chunks have size 0
+typedef struct {
+    point_t key;
+    uint32_t size;
+} autosave_chunk_t;
+
+// followed by count entries
+typedef struct {
+    uint64_t previous;
+    uint64_t count;
+} autosave_index_t;
+
+typedef struct {
+    point_t key;
+    uint32_t size;
+    uint64_t offset;
+} autosave_entry_t;
+
+static uint64_t record_bytes(uint32_t size) {
+    return sizeof(autosave_chunk_t) + size + sizeof(autosave_entry_t);
+}
+
+// data must reach disk before header points to it
+static bool autosave_sync(FILE *file) {
+    return fflush(file) == 0 && fsync(fileno(file)) == 0;
+}
+
+static bool autosave_write_header(FILE *file, uint16_t map_version, uint64_t index_offset) {
+    autosave_header_t header = {
+        .magic = AUTOSAVE_MAGIC,
+        .version = AUTOSAVE_VERSION,
+        .map_version = map_version,
+        .index_offset = index_offset,
+    };
+    return fseek(file, 0, SEEK_SET) == 0 &&
+        fwrite(&header, sizeof(header), 1, file) == 1 &&
+        autosave_sync(file);
+}
+
+void autosave_init(autosave_t *save, const char *path) {
+    *save = (autosave_t){ 0 };
+    save->path = strdup(path);
+    assert(save->path != NULL && "No RAM");
+}
+
+void autosave_free(autosave_t *save) {
+    if (save->file != NULL) fclose(save->file);
+    hmfree(save->records);
+    free(save->path);
+    *save = (autosave_t){ 0 };
+}
+
+// writes chunks with DIRTY_AUTOSAVE set (or all of them) and their index
+static bool autosave_append(autosave_t *save, map_t *map, bool everything) {
+    autosave_entry_t *entries = NULL;
+    uint8_t cells[CHUNK_LAYOUT_MAX_SIZE];
+    uint64_t offset = save->file_size;
+    bool ok = fseek(save->file, offset, SEEK_SET) == 0;
+    // paged out chunks are read without faulting them in
+    const size_t resident = hmlenu(map->chunks);
+    chunk_t paged;
+    for (size_t i = 0; i < resident + hmlenu(map->pager.chunks) && ok; i++) {
+        const chunk_t *chunk = &paged;
+        if (i < resident) chunk = map->chunks[i].value;
+        else if (everything || map->pager.chunks[i - resident].value.dirty & DIRTY_AUTOSAVE)
+            map_paged_read(map, i - resident, &paged);
+        else continue;
+        if (!everything && !(chunk->dirty & DIRTY_AUTOSAVE)) continue;
+        autosave_chunk_t record = {
+            .key = i < resident ? map->chunks[i].key : map->pager.chunks[i - resident].key,
+            .size = chunk_encode_layout(chunk, cells),
+        };
+        // nothing to remove
+        if (record.size == 0 && hmgetp_null(save->records, record.key) == NULL) continue;
+        ok = fwrite(&record, sizeof(record), 1, save->file) == 1 &&
+            fwrite(cells, 1, record.size, save->file) == record.size;
+        arrput(entries, ((autosave_entry_t){ .key = record.key, .size = record.size, .offset = offset }));
+        offset += sizeof(record) + record.size;
+    }
+    if (ok && arrlenu(entries) == 0) {
+        arrfree(entries);
+        return true;
+    }
+    autosave_index_t index = {
+        .previous = save->index_offset,
+        .count = arrlenu(entries),
+    };
+    ok = ok && fwrite(&index, sizeof(index), 1, save->file) == 1 &&
+        fwrite(entries, sizeof(*entries), index.count, save->file) == index.count &&
+        autosave_sync(save->file) &&
+        autosave_write_header(save->file, map->version, offset);
+    if (ok) {
+        save->index_offset = offset;
+        save->file_size = offset + sizeof(index) + index.count*sizeof(*entries);
+        save->live_bytes += sizeof(index);
+        for (size_t i = 0; i < index.count; i++) {
+            struct AutosaveRecord *old = hmgetp_null(save->records, entries[i].key);
+            if (old != NULL) {
+                save->live_bytes -= record_bytes(old->value.size);
+                (void)hmdel(save->records, entries[i].key);
+            }
+            if (entries[i].size == 0) continue;
+            struct AutosaveRecord record = { .key = entries[i].key };
+            record.value.offset = entries[i].offset;
+            record.value.size = entries[i].size;
+            hmputs(save->records, record);
+            save->live_bytes += record_bytes(entries[i].size);
+        }
+        for (size_t i = 0; i < hmlenu(map->chunks); i++) {
+            map->chunks[i].value->dirty &= ~DIRTY_AUTOSAVE;
+        }
+        for (size_t i = 0; i < hmlenu(map->pager.chunks); i++) {
+            map->pager.chunks[i].value.dirty &= ~DIRTY_AUTOSAVE;
+        }
+    }
+    arrfree(entries);
+    return ok;
+}
+
+static char* temporary_path(const char *path) {
+    char *result = malloc(strlen(path) + sizeof(".tmp"));
+    assert(result != NULL && "No RAM");
+    strcpy(result, path);
+    strcat(result, ".tmp");
+    return result;
+}
+
+// replaces file with new one having every chunk of the map,
+// old file stays untouched until new one is complete
+static bool autosave_start(autosave_t *save, map_t *map) {
+    char *tmp = temporary_path(save->path);
+    if (save->file != NULL) fclose(save->file);
+    hmfree(save->records);
+    save->file = fopen(tmp, "w+b");
+    save->file_size = sizeof(autosave_header_t);
+    save->index_offset = 0;
+    save->live_bytes = 0;
+    bool ok = save->file != NULL &&
+        autosave_write_header(save->file, map->version, 0) &&
+        autosave_append(save, map, true) &&
+        rename(tmp, save->path) == 0;
+    if (!ok) {
+        perror(save->path);
+        if (save->file != NULL) fclose(save->file);
+        save->file = NULL;
+        remove(tmp);
+    }
+    free(tmp);
+    return ok;
+}
+
+// rewrites file with only the latest record of every chunk,
+// doesn't need the map, so chunks don't have to be loaded
+static bool autosave_compact(autosave_t *save, uint16_t map_version) {
+    char *tmp = temporary_path(save->path);
+    FILE *file = fopen(tmp, "w+b");
+    autosave_entry_t *entries = NULL;
+    uint64_t offset = sizeof(autosave_header_t);
+    bool ok = file != NULL && autosave_write_header(file, map_version, 0) &&
+        fseek(file, offset, SEEK_SET) == 0;
+    uint8_t cells[sizeof(autosave_chunk_t) + CHUNK_LAYOUT_MAX_SIZE];
+    for (size_t i = 0; i < hmlenu(save->records) && ok; i++) {
+        const size_t size = sizeof(autosave_chunk_t) + save->records[i].value.size;
+        ok = size <= sizeof(cells) &&
+            fseek(save->file, save->records[i].value.offset, SEEK_SET) == 0 &&
+            fread(cells, 1, size, save->file) == size &&
+            fwrite(cells, 1, size, file) == size;
+        arrput(entries, ((autosave_entry_t){ .key = save->records[i].key, .size = save->records[i].value.size, .offset = offset }));
+        offset += size;
+    }
+    autosave_index_t index = { .previous = 0, .count = arrlenu(entries) };
+    ok = ok && fwrite(&index, sizeof(index), 1, file) == 1 &&
+        fwrite(entries, sizeof(*entries), index.count, file) == index.count &&
+        autosave_sync(file) &&
+        autosave_write_header(file, map_version, offset) &&
+        rename(tmp, save->path) == 0;
+    if (ok) {
+        fclose(save->file);
+        save->file = file;
+        save->index_offset = offset;
+        save->file_size = offset + sizeof(index) + index.count*sizeof(*entries);
+        save->live_bytes = sizeof(index);
+        for (size_t i = 0; i < index.count; i++) {
+            save->records[i].value.offset = entries[i].offset;
+            save->live_bytes += record_bytes(entries[i].size);
+        }
+    } else {
+        perror(save->path);
+        if (file != NULL) fclose(file);
+        remove(tmp);
+    }
+    arrfree(entries);
+    free(tmp);
+    return ok;
+}
+
+bool autosave_save(autosave_t *save, map_t *map) {
+    map_apply_edits(map);
+    if (save->file == NULL) return autosave_start(save, map);
+    if (!autosave_append(save, map, false)) {
+        perror(save->path);
+        // file may be in any state now, so next save starts over
+        fclose(save->file);
+        save->file = NULL;
+        return false;
+    }
+    if (save->file_size > AUTOSAVE_COMPACT_MIN &&
+            save->file_size > AUTOSAVE_COMPACT_RATIO*save->live_bytes) {
+        // failed compaction leaves valid file behind
+        autosave_compact(save, map->version);
+    }
+    return true;
+}
+
+static bool same_file(const char *a, const char *b) {
+    struct stat x, y;
+    return stat(a, &x) == 0 && stat(b, &y) == 0 && x.st_dev == y.st_dev && x.st_ino == y.st_ino;
+}
+
+char* autosave_session_path(const char *path, const char *loaded) {
+    if (access(path, F_OK) != 0 || same_file(path, loaded)) {
+        char *result = strdup(path);
+        assert(result != NULL && "No RAM");
+        return result;
+    }
+    // number goes before extension of file name, not of directory
+    const char *name = strrchr(path, '/');
+    const char *dot = strrchr(name != NULL ? name : path, '.');
+    const size_t stem = dot != NULL ? (size_t)(dot - path) : strlen(path);
+    const size_t size = strlen(path) + 16;
+    char *result = malloc(size);
+    assert(result != NULL && "No RAM");
+    for (unsigned n = 1; ; n++) {
+        snprintf(result, size, "%.*s-%u%s", (int)stem, path, n, path + stem);
+        if (access(result, F_OK) != 0 || same_file(result, loaded)) return result;
+    }
+}
+
+bool is_autosave(const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) return false;
+    char magic[sizeof(AUTOSAVE_MAGIC)];
+    bool result = fread(magic, 1, sizeof(magic), file) == sizeof(magic) &&
+        memcmp(magic, AUTOSAVE_MAGIC, sizeof(magic)) == 0;
+    fclose(file);
+    return result;
+}
+
+bool autosave_load(map_t *map, const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        perror(path);
+        return false;
+    }
+    autosave_header_t header;
+    const char *error = NULL;
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+            memcmp(header.magic, AUTOSAVE_MAGIC, sizeof(header.magic)) != 0) {
+        error = "not an autosave";
+    } else if (header.version != AUTOSAVE_VERSION) {
+        error = "unsupported autosave version";
+    }
+
+    // newest record of every chunk, older ones are skipped
+    struct { point_t key; autosave_entry_t value; } *latest = NULL;
+    uint64_t index_offset = header.index_offset;
+    while (error == NULL && index_offset != 0) {
+        autosave_index_t index;
+        if (fseek(file, index_offset, SEEK_SET) != 0 ||
+                fread(&index, sizeof(index), 1, file) != 1 ||
+                // indices only point backwards, so walking always ends
+                index.previous >= index_offset) {
+            error = "autosave is corrupted";
+            break;
+        }
+        for (uint64_t i = 0; i < index.count; i++) {
+            autosave_entry_t entry;
+            if (fread(&entry, sizeof(entry), 1, file) != 1) {
+                error = "autosave is truncated";
+                break;
+            }
+            if (hmgetp_null(latest, entry.key) == NULL) hmput(latest, entry.key, entry);
+        }
+        index_offset = index.previous;
+    }
+
+    uint8_t cells[CHUNK_LAYOUT_MAX_SIZE];
+    for (size_t i = 0; i < hmlenu(latest) && error == NULL; i++) {
+        const autosave_entry_t *entry = &latest[i].value;
+        if (entry->size == 0) continue;
+        autosave_chunk_t record;
+        if (fseek(file, entry->offset, SEEK_SET) != 0 ||
+                fread(&record, sizeof(record), 1, file) != 1 ||
+                record.key.x != entry->key.x || record.key.y != entry->key.y ||
+                record.size > CHUNK_LAYOUT_MAX_SIZE ||
+                fread(cells, 1, record.size, file) != record.size) {
+            error = "autosave is corrupted";
+            break;
+        }
+        chunk_t *chunk = map_get_chunk(map, record.key.x*CHUNK_SIZE, record.key.y*CHUNK_SIZE);
+        if (!chunk_decode_layout(cells, record.size, chunk)) error = "autosave has unknown cell type";
+    }
+    if (error == NULL) map->version = header.map_version;
+    else fprintf(stderr, "%s: %s\n", path, error);
+    hmfree(latest);
+    fclose(file);
+    return error == NULL;
+}
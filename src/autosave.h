@@ -0,0 +1,42 @@
+#ifndef AUTOSAVE_H
+#define AUTOSAVE_H
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "map.h"
+
+#define AUTOSAVE_MAGIC "ARWSAVE"
+
+// append-only save of map layout, every save writes only chunks
+// with DIRTY_AUTOSAVE set and small index of them, file is
+// rewritten with only the latest records once it grows too much
+typedef struct {
+    char *path;
+    // NULL until first save, which always starts new file
+    FILE *file;
+    uint64_t file_size;
+    // index written by the last save
+    uint64_t index_offset;
+    // latest record of every chunk written to file
+    struct AutosaveRecord { point_t key; struct { uint64_t offset; uint32_t size; } value; } *records;
+    // size of latest records, everything else in file is garbage
+    uint64_t live_bytes;
+} autosave_t;
+
+void autosave_init(autosave_t *save, const char *path);
+// must be called between ticks by the thread running map_update
+bool autosave_save(autosave_t *save, map_t *map);
+void autosave_free(autosave_t *save);
+// loads layout into freshly initialized map
+bool autosave_load(map_t *map, const char *path);
+// path autosave of this session should use, existing file is
+// reused only if it's the one map was loaded from, otherwise
+// first free path with number added is returned, so autosave
+// of the previous session survives a crash of this one, free
+// result with free
+char* autosave_session_path(const char *path, const char *loaded);
+// checks whether file starts with AUTOSAVE_MAGIC
+bool is_autosave(const char *path);
+
+#endif // AUTOSAVE_H
@@ -0,0 +1,140 @@
+#include <string.h>
+
+#include "stb_ds.h"
+#include "base64.h"
+
+static const char base64_alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+#define XX 0xFF
+// sextet for every character, XX for characters outside of alphabet
+static const uint8_t base64_table[256] = {
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, 62, XX, XX, XX, 63,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, XX, XX, XX, XX, XX, XX,
+    XX,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, XX, XX, XX, XX, XX,
+    XX, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, XX, XX, XX, XX, XX,
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+};
+#undef XX
+
+ptrdiff_t base64_decode(const char *input, size_t length, uint8_t *output) {
+    const uint8_t *in = (const uint8_t*)input;
+    size_t padding = 0;
+    while (length > 0 && padding < 2 && in[length - 1] == '=') {
+        length--;
+        padding++;
+    }
+    if (padding > 0 && (length + padding) % 4 != 0) return -1;
+
+    uint8_t *out = output;
+    const size_t full = length / 4 * 4;
+    for (size_t i = 0; i < full; i += 4) {
+        uint32_t a = base64_table[in[i + 0]], b = base64_table[in[i + 1]],
+                 c = base64_table[in[i + 2]], d = base64_table[in[i + 3]];
+        // any invalid character sets the high bit
+        if ((a | b | c | d) & 0x80) return -1;
+        uint32_t value = a << 18 | b << 12 | c << 6 | d;
+        out[0] = value >> 16;
+        out[1] = value >> 8;
+        out[2] = value;
+        out += 3;
+    }
+
+    // last group without padding
+    uint32_t value = 0;
+    switch (length - full) {
+        case 0:
+            break;
+        case 1:
+            return -1;
+        case 2: {
+            uint32_t a = base64_table[in[full + 0]], b = base64_table[in[full + 1]];
+            if ((a | b) & 0x80) return -1;
+            value = a << 18 | b << 12;
+            *out++ = value >> 16;
+        } break;
+        case 3: {
+            uint32_t a = base64_table[in[full + 0]], b = base64_table[in[full + 1]],
+                     c = base64_table[in[full + 2]];
+            if ((a | b | c) & 0x80) return -1;
+            value = a << 18 | b << 12 | c << 6;
+            *out++ = value >> 16;
+            *out++ = value >> 8;
+        } break;
+    }
+    return out - output;
+}
+
+static void base64_flush(base64_writer_t *writer) {
+    if (writer->block_size == 0) return;
+    if (writer->file != NULL) {
+        if (fwrite(writer->block, 1, writer->block_size, writer->file) != writer->block_size)
+            writer->failed = true;
+    } else {
+        memcpy(arraddnptr(writer->string, writer->block_size), writer->block, writer->block_size);
+    }
+    writer->block_size = 0;
+}
+
+static inline void base64_encode_group(base64_writer_t *writer, const uint8_t *group) {
+    if (writer->block_size + 4 > BASE64_BLOCK_SIZE)
+        base64_flush(writer);
+    uint32_t value = (uint32_t)group[0] << 16 | (uint32_t)group[1] << 8 | group[2];
+    char *out = writer->block + writer->block_size;
+    out[0] = base64_alphabet[(value >> 18) & 0x3F];
+    out[1] = base64_alphabet[(value >> 12) & 0x3F];
+    out[2] = base64_alphabet[(value >>  6) & 0x3F];
+    out[3] = base64_alphabet[(value >>  0) & 0x3F];
+    writer->block_size += 4;
+}
+
+void base64_write(base64_writer_t *writer, const void *data, size_t size) {
+    const uint8_t *in = data;
+    while (writer->pending_count > 0 && writer->pending_count < 3 && size > 0) {
+        writer->pending[writer->pending_count++] = *in++;
+        size--;
+    }
+    if (writer->pending_count == 3) {
+        base64_encode_group(writer, writer->pending);
+        writer->pending_count = 0;
+    }
+    for (; size >= 3; in += 3, size -= 3) {
+        base64_encode_group(writer, in);
+    }
+    while (size > 0) {
+        writer->pending[writer->pending_count++] = *in++;
+        size--;
+    }
+}
+
+bool base64_finish(base64_writer_t *writer) {
+    if (writer->pending_count > 0) {
+        const int count = writer->pending_count;
+        memset(writer->pending + count, 0, 3 - count);
+        base64_encode_group(writer, writer->pending);
+        // one '=' for every missing byte
+        for (int i = count; i < 3; i++) {
+            writer->block[writer->block_size - 3 + i] = '=';
+        }
+        writer->pending_count = 0;
+    }
+    base64_flush(writer);
+    if (writer->file == NULL) {
+        // terminator stays in capacity, not in length
+        arrput(writer->string, '\0');
+        (void)arrpop(writer->string);
+    } else if (fflush(writer->file) != 0) {
+        writer->failed = true;
+    }
+    return !writer->failed;
+}
@@ -0,0 +1,35 @@
+#ifndef BASE64_H
+#define BASE64_H
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// upper bound of decoded size for `length` characters
+#define BASE64_DECODED_SIZE(length) (((length) + 3) / 4 * 3)
+
+// decodes standard base64, padding is optional,
+// returns number of written bytes or -1 if input is invalid
+ptrdiff_t base64_decode(const char *input, size_t length, uint8_t *output);
+
+#define BASE64_BLOCK_SIZE 4096
+
+// streaming encoder, output goes to `file` if it's not NULL,
+// otherwise it's appended to stb_ds array `string`
+typedef struct {
+    FILE *file;
+    char *string;
+    // bytes which don't make full group yet
+    uint8_t pending[3];
+    int pending_count;
+    char block[BASE64_BLOCK_SIZE];
+    size_t block_size;
+    bool failed;
+} base64_writer_t;
+
+void base64_write(base64_writer_t *writer, const void *data, size_t size);
+// encodes what's left with padding and flushes output,
+// returns false if writing to file failed
+bool base64_finish(base64_writer_t *writer);
+
+#endif // BASE64_H
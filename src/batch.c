@@ -0,0 +1,97 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+
+#include "stb_ds.h"
+#include "map.h"
+#include "load.h"
+#include "batch.h"
+
+typedef struct {
+    const char *input;
+    int ticks;
+    // results
+    enum ImportError error;
+    size_t chunks;
+    double elapsed;
+    uint64_t checksum;
+} batch_task_t;
+
+// biggest maps go first so they don't end up last on a single core
+static int batch_compare(const void *a, const void *b) {
+    size_t la = strlen((*(batch_task_t**)a)->input), lb = strlen((*(batch_task_t**)b)->input);
+    return la < lb ? 1 : la > lb ? -1 : 0;
+}
+
+static void batch_task(batch_task_t *task) {
+    map_t map = { 0 };
+    map_init(&map);
+    // parallelism comes from running many maps at once
+    map.max_threads = 1;
+    task->error = map_import(&map, task->input);
+    if (task->error != IMPORT_OK) {
+        map_free(&map);
+        return;
+    }
+    double start = omp_get_wtime();
+    for (int i = 0; i < task->ticks; i++) {
+        map_update(&map);
+    }
+    task->elapsed = omp_get_wtime() - start;
+    task->chunks = hmlenu(map.chunks);
+    task->checksum = map_checksum(&map);
+    map_free(&map);
+}
+
+int batch_run(int argc, char **argv) {
+    if (argc < 1) {
+        fprintf(stderr, "Usage: --batch <maps file> [ticks]\n");
+        return 1;
+    }
+    int ticks = argc > 1 ? atoi(argv[1]) : 1000;
+    char **maps = load_quoted(argv[0]);
+    if (maps == NULL) return 1;
+
+    const size_t count = arrlenu(maps);
+    batch_task_t *tasks = calloc(count, sizeof(*tasks));
+    batch_task_t **order = calloc(count, sizeof(*order));
+    if (count > 0 && (tasks == NULL || order == NULL)) {
+        fprintf(stderr, "No RAM\n");
+        free(order);
+        free(tasks);
+        free_quoted(maps);
+        return 1;
+    }
+    for (size_t i = 0; i < count; i++) {
+        tasks[i] = (batch_task_t){ .input = maps[i], .ticks = ticks };
+        order[i] = &tasks[i];
+    }
+    qsort(order, count, sizeof(*order), batch_compare);
+
+    double start = omp_get_wtime();
+#pragma omp parallel for schedule(dynamic, 1)
+    for (size_t i = 0; i < count; i++) {
+        batch_task(order[i]);
+    }
+    double elapsed = omp_get_wtime() - start;
+
+    long long total_ticks = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (tasks[i].error != IMPORT_OK) {
+            printf("map %zu: %s\n", i, import_error_string(tasks[i].error));
+            continue;
+        }
+        printf("map %zu: %zu chunks, %d ticks, %.3f ms/tick, checksum %016llx\n",
+                i, tasks[i].chunks, tasks[i].ticks,
+                tasks[i].ticks > 0 ? tasks[i].elapsed / tasks[i].ticks * 1e3 : 0.,
+                (unsigned long long)tasks[i].checksum);
+        total_ticks += tasks[i].ticks;
+    }
+    printf("%zu maps on %d threads in %.3f s, %.0f ticks/s\n",
+            count, omp_get_max_threads(), elapsed, elapsed > 0 ? total_ticks / elapsed : 0.);
+    free(order);
+    free(tasks);
+    free_quoted(maps);
+    return 0;
+}
@@ -0,0 +1,8 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+// usage: --batch <maps file> [ticks]
+// simulates every map from file on its own core
+int batch_run(int argc, char **argv);
+
+#endif // BATCH_H
@@ -0,0 +1,420 @@
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+
+#include "stb_ds.h"
+#include "map.h"
+#include "bench.h"
+#include "load.h"
+#include "base64.h"
+
+#define BENCH_WARMUP_TICKS 10
+
+// decoder map_import used before table was introduced,
+// kept to see how much faster the new one is
+static size_t base64_decode_strchr(const char *input, uint8_t *buffer) {
+    size_t buffer_size = 0;
+    size_t length = strlen(input);
+    const char base64chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    for (size_t i = 0; i < length; i += 4) {
+        uint8_t sextet[4];
+
+        for (size_t j = 0; j < 4; j++) {
+            sextet[j] = strchr(base64chars, input[i + j]) - base64chars;
+        }
+
+        uint32_t decoded_value = (sextet[0] << 18) | (sextet[1] << 12) | (sextet[2] << 6) | sextet[3];
+
+        for (int j = 2; j >= 0; j--) {
+            if (i + j < length - 1) {
+                char decoded_char = (decoded_value >> (j * 8)) & 0xFF;
+                buffer[buffer_size++] = decoded_char;
+            }
+        }
+    }
+    return buffer_size;
+}
+
+// bounding box of chunk keys
+static void map_bounds(map_t *map, point_t *min, point_t *size) {
+    int32_t min_x = INT32_MAX, min_y = INT32_MAX, max_x = INT32_MIN, max_y = INT32_MIN;
+    for (size_t i = 0; i < hmlenu(map->chunks); i++) {
+        point_t key = map->chunks[i].key;
+        if (key.x < min_x) min_x = key.x;
+        if (key.y < min_y) min_y = key.y;
+        if (key.x > max_x) max_x = key.x;
+        if (key.y > max_y) max_y = key.y;
+    }
+    *min = (point_t){ min_x, min_y };
+    *size = (point_t){ max_x - min_x + 1, max_y - min_y + 1 };
+}
+
+// copies layout of `from` into `to` at tile tx, ty
+static void map_tile_at(map_t *to, map_t *from, int tx, int ty) {
+    point_t min, size;
+    map_bounds(from, &min, &size);
+    for (size_t i = 0; i < hmlenu(from->chunks); i++) {
+        point_t key = from->chunks[i].key;
+        chunk_t *chunk = map_get_chunk(to,
+                (key.x + tx*size.x)*CHUNK_SIZE,
+                (key.y + ty*size.y)*CHUNK_SIZE);
+        memcpy(chunk->arrows, from->chunks[i].value->arrows, sizeof(chunk->arrows));
+    }
+}
+
+// copies layout of `from` into `to` tiles x tiles times
+static void map_tile(map_t *to, map_t *from, int tiles) {
+    for (int ty = 0; ty < tiles; ty++) {
+        for (int tx = 0; tx < tiles; tx++) {
+            map_tile_at(to, from, tx, ty);
+        }
+    }
+}
+
+int bench_placement(int argc, char **argv) {
+    const char *path = argc > 0 ? argv[0] : "maps.txt";
+    int tiles = argc > 1 ? atoi(argv[1]) : 16;
+    int ticks = argc > 2 ? atoi(argv[2]) : 200;
+    char **maps = load_quoted(path);
+    if (maps == NULL) return 1;
+
+    static const char *placement_names[] = {
+        [PLACEMENT_LOCAL] = "local",
+        [PLACEMENT_INTERLEAVED] = "interleaved",
+    };
+    for (size_t m = 0; m < arrlenu(maps); m++) {
+        map_t source = { 0 };
+        map_init(&source);
+        map_import(&source, maps[m]);
+        for (enum Placement placement = PLACEMENT_LOCAL; placement <= PLACEMENT_INTERLEAVED; placement++) {
+            map_t map = { 0 };
+            map_init(&map);
+            map.placement = placement;
+            map_tile(&map, &source, tiles);
+            for (int i = 0; i < BENCH_WARMUP_TICKS; i++) map_update(&map);
+            double start = omp_get_wtime();
+            for (int i = 0; i < ticks; i++) map_update(&map);
+            double elapsed = omp_get_wtime() - start;
+            printf("map %zu: %zu chunks on %d node(s), %-11s %8.3f ms/tick (%d threads)\n",
+                    m, hmlenu(map.chunks), map.node_count, placement_names[placement],
+                    elapsed / ticks * 1e3, map.stats.threads);
+            map_free(&map);
+        }
+        map_free(&source);
+    }
+    free_quoted(maps);
+    return 0;
+}
+
+int bench_import(int argc, char **argv) {
+    const char *path = argc > 0 ? argv[0] : "maps.txt";
+    int iterations = argc > 1 ? atoi(argv[1]) : 100;
+    char **maps = load_quoted(path);
+    if (maps == NULL) return 1;
+
+    for (size_t m = 0; m < arrlenu(maps); m++) {
+        const size_t length = strlen(maps[m]);
+        // old decoder may write whole last group
+        uint8_t *buffer = malloc(BASE64_DECODED_SIZE(length) + 3);
+        if (buffer == NULL) {
+            fprintf(stderr, "No RAM\n");
+            free_quoted(maps);
+            return 1;
+        }
+        double start = omp_get_wtime();
+        for (int i = 0; i < iterations; i++) base64_decode_strchr(maps[m], buffer);
+        double strchr_time = (omp_get_wtime() - start) / iterations;
+
+        start = omp_get_wtime();
+        for (int i = 0; i < iterations; i++) base64_decode(maps[m], length, buffer);
+        double table_time = (omp_get_wtime() - start) / iterations;
+
+        start = omp_get_wtime();
+        for (int i = 0; i < iterations; i++) {
+            map_t map = { 0 };
+            map_init(&map);
+            map_import(&map, maps[m]);
+            map_free(&map);
+        }
+        double import_time = (omp_get_wtime() - start) / iterations;
+
+        printf("map %zu: %zu bytes, strchr %.1f MB/s, table %.1f MB/s (%.1fx), map_import %.3f ms\n",
+                m, length, length / strchr_time / 1e6, length / table_time / 1e6,
+                strchr_time / table_time, import_time * 1e3);
+        free(buffer);
+    }
+    free_quoted(maps);
+    return 0;
+}
+
+int bench_export(int argc, char **argv) {
+    const char *path = argc > 0 ? argv[0] : "maps.txt";
+    int tiles = argc > 1 ? atoi(argv[1]) : 16;
+    char **maps = load_quoted(path);
+    if (maps == NULL) return 1;
+
+    for (size_t m = 0; m < arrlenu(maps); m++) {
+        map_t source = { 0 };
+        map_init(&source);
+        map_import(&source, maps[m]);
+        map_t map = { 0 };
+        map_init(&map);
+        map_tile(&map, &source, tiles);
+        size_t cells = 0;
+        for (size_t i = 0; i < hmlenu(map.chunks); i++) {
+            for (size_t j = 0; j < CHUNK_SIZE*CHUNK_SIZE; j++) {
+                cells += map.chunks[i].value->arrows[j].type != Empty;
+            }
+        }
+        double start = omp_get_wtime();
+        char *output = map_export(&map);
+        double elapsed = omp_get_wtime() - start;
+        if (output == NULL) {
+            printf("map %zu: too many chunks to export (%zu)\n", m, hmlenu(map.chunks));
+        } else {
+            printf("map %zu: %zu cells in %.3f ms, %zu bytes, %.1f Mcells/s\n",
+                    m, cells, elapsed * 1e3, arrlenu(output), cells / elapsed / 1e6);
+            arrfree(output);
+        }
+        map_free(&map);
+        map_free(&source);
+    }
+    free_quoted(maps);
+    return 0;
+}
+
+// ticks after every generated row, enough for it's quiet chunks to go cold
+#define BENCH_PAGER_ROW_TICKS 8
+
+// generates map row by row so cold rows are evicted before next one is
+// made, then compares it with the same map kept in memory
+int bench_pager(int argc, char **argv) {
+    const char *path = argc > 0 ? argv[0] : "maps.txt";
+    int tiles = argc > 1 ? atoi(argv[1]) : 16;
+    size_t budget = argc > 2 ? strtoull(argv[2], NULL, 10) : 1024;
+    int ticks = argc > 3 ? atoi(argv[3]) : 100;
+    const char *page_path = argc > 4 ? argv[4] : "pager.bin";
+    const bool in_memory = strcmp(page_path, "-") == 0;
+    char **maps = load_quoted(path);
+    if (maps == NULL) return 1;
+
+    for (size_t m = 0; m < arrlenu(maps); m++) {
+        map_t source = { 0 };
+        map_init(&source);
+        map_import(&source, maps[m]);
+        map_t paged = { 0 }, plain = { 0 };
+        map_init(&paged);
+        map_init(&plain);
+        if (!map_pager_open(&paged, in_memory ? NULL : page_path, budget)) {
+            map_free(&paged);
+            map_free(&plain);
+            map_free(&source);
+            free_quoted(maps);
+            return 1;
+        }
+
+        size_t peak = 0;
+        double paged_time = 0, plain_time = 0;
+        for (int ty = 0; ty < tiles; ty++) {
+            for (int tx = 0; tx < tiles; tx++) {
+                map_tile_at(&paged, &source, tx, ty);
+                map_tile_at(&plain, &source, tx, ty);
+            }
+            for (int i = 0; i < BENCH_PAGER_ROW_TICKS; i++) {
+                map_update(&paged);
+                map_update(&plain);
+                if (hmlenu(paged.chunks) > peak) peak = hmlenu(paged.chunks);
+            }
+        }
+        for (int i = 0; i < ticks; i++) {
+            double start = omp_get_wtime();
+            map_update(&paged);
+            paged_time += omp_get_wtime() - start;
+            start = omp_get_wtime();
+            map_update(&plain);
+            plain_time += omp_get_wtime() - start;
+            if (hmlenu(paged.chunks) > peak) peak = hmlenu(paged.chunks);
+        }
+        printf("map %zu: %zu chunks, peak %zu resident, %zu paged out (%.1f bytes each), %zu evictions, %zu faults, "
+                "%.3f ms/tick (in memory %.3f), checksum %s\n",
+                m, hmlenu(plain.chunks), peak, hmlenu(paged.pager.chunks),
+                hmlenu(paged.pager.chunks) > 0 ? (double)paged.pager.bytes / hmlenu(paged.pager.chunks) : 0.,
+                paged.pager.evictions, paged.pager.faults,
+                paged_time / ticks * 1e3, plain_time / ticks * 1e3,
+                map_checksum(&paged) == map_checksum(&plain) ? "same" : "DIFFERENT");
+        map_free(&paged);
+        map_free(&plain);
+        map_free(&source);
+    }
+    if (!in_memory) remove(page_path);
+    free_quoted(maps);
+    return 0;
+}
+
+// compares chunk_encode_layout with map_import format, speed is
+// measured in bytes of chunk cell arrays processed per second
+int bench_codec(int argc, char **argv) {
+    const char *path = argc > 0 ? argv[0] : "maps.txt";
+    int iterations = argc > 1 ? atoi(argv[1]) : 100;
+    char **maps = load_quoted(path);
+    if (maps == NULL) return 1;
+
+    for (size_t m = 0; m < arrlenu(maps); m++) {
+        map_t map = { 0 };
+        map_init(&map);
+        map_import(&map, maps[m]);
+        const size_t chunk_count = hmlenu(map.chunks);
+        const double array_bytes = (double)chunk_count * sizeof(map.chunks[0].value->arrows);
+        size_t cells = 0;
+        for (size_t i = 0; i < chunk_count; i++) {
+            for (size_t j = 0; j < CHUNK_SIZE*CHUNK_SIZE; j++) {
+                cells += map.chunks[i].value->arrows[j].type != Empty;
+            }
+        }
+        if (cells == 0) {
+            map_free(&map);
+            continue;
+        }
+
+        uint8_t *encoded = malloc(chunk_count * CHUNK_LAYOUT_MAX_SIZE);
+        size_t *sizes = malloc(chunk_count * sizeof(*sizes));
+        chunk_t *decoded = malloc(sizeof(*decoded));
+        if (encoded == NULL || sizes == NULL || decoded == NULL) {
+            fprintf(stderr, "No RAM\n");
+            free(encoded);
+            free(sizes);
+            free(decoded);
+            map_free(&map);
+            free_quoted(maps);
+            return 1;
+        }
+        size_t codec_bytes = 0;
+        double start = omp_get_wtime();
+        for (int it = 0; it < iterations; it++) {
+            codec_bytes = 0;
+            for (size_t i = 0; i < chunk_count; i++) {
+                sizes[i] = chunk_encode_layout(map.chunks[i].value, encoded + i*CHUNK_LAYOUT_MAX_SIZE);
+                codec_bytes += sizes[i];
+            }
+        }
+        double encode_time = (omp_get_wtime() - start) / iterations;
+        bool same = true;
+        start = omp_get_wtime();
+        for (int it = 0; it < iterations; it++) {
+            for (size_t i = 0; i < chunk_count; i++) {
+                same &= chunk_decode_layout(encoded + i*CHUNK_LAYOUT_MAX_SIZE, sizes[i], decoded);
+            }
+        }
+        double decode_time = (omp_get_wtime() - start) / iterations;
+        for (size_t i = 0; i < chunk_count && same; i++) {
+            chunk_decode_layout(encoded + i*CHUNK_LAYOUT_MAX_SIZE, sizes[i], decoded);
+            for (size_t j = 0; j < CHUNK_SIZE*CHUNK_SIZE; j++) {
+                const arrow_t *a = &decoded->arrows[j], *b = &map.chunks[i].value->arrows[j];
+                same &= a->type == b->type && (a->type == Empty ||
+                        (a->direction == b->direction && a->flipped == b->flipped));
+            }
+        }
+
+        start = omp_get_wtime();
+        char *exported = NULL;
+        for (int it = 0; it < iterations; it++) {
+            arrfree(exported);
+            exported = map_export(&map);
+        }
+        double export_time = (omp_get_wtime() - start) / iterations;
+        start = omp_get_wtime();
+        for (int it = 0; it < iterations; it++) {
+            map_t imported = { 0 };
+            map_init(&imported);
+            map_import(&imported, exported);
+            map_free(&imported);
+        }
+        double import_time = (omp_get_wtime() - start) / iterations;
+        const size_t text_bytes = arrlenu(exported);
+
+        printf("map %zu: %zu cells in %zu chunks\n", m, cells, chunk_count);
+        printf("  import format: %.2f bytes/cell (%.2f as base64), export %.2f GB/s, import %.2f GB/s\n",
+                text_bytes * 3. / 4 / cells, (double)text_bytes / cells,
+                array_bytes / export_time / 1e9, array_bytes / import_time / 1e9);
+        printf("  chunk codec:   %.2f bytes/cell, encode %.2f GB/s, decode %.2f GB/s, round trip %s\n",
+                (double)codec_bytes / cells,
+                array_bytes / encode_time / 1e9, array_bytes / decode_time / 1e9,
+                same ? "ok" : "FAILED");
+        arrfree(exported);
+        free(encoded);
+        free(sizes);
+        free(decoded);
+        map_free(&map);
+    }
+    free_quoted(maps);
+    return 0;
+}
+
+// reads whole file as string, returns NULL on failure
+static char* read_text(const char *path, size_t *size) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) return NULL;
+    char *text = NULL;
+    char block[4096];
+    size_t read;
+    while ((read = fread(block, 1, sizeof(block), file)) > 0) {
+        memcpy(arraddnptr(text, read), block, read);
+    }
+    fclose(file);
+    *size = arrlenu(text);
+    arrput(text, '\0');
+    return text;
+}
+
+// replays inputs saved by fuzz/slow.c, so worst-case latency is tracked
+int bench_worst(int argc, char **argv) {
+    const char *path = argc > 0 ? argv[0] : "fuzz/worst";
+    int ticks = argc > 1 ? atoi(argv[1]) : 100;
+    DIR *dir = opendir(path);
+    if (dir == NULL) {
+        perror(path);
+        return 1;
+    }
+    double worst_tick = 0, worst_byte = 0;
+    size_t worst_events = 0;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (entry->d_name[0] == '.') continue;
+        char file[4096];
+        snprintf(file, sizeof(file), "%s/%s", path, entry->d_name);
+        size_t size;
+        char *input = read_text(file, &size);
+        if (input == NULL) {
+            perror(file);
+            continue;
+        }
+        map_t map = { 0 };
+        map_init(&map);
+        double start = omp_get_wtime();
+        enum ImportError error = map_import(&map, input);
+        const double byte_time = size > 0 ? (omp_get_wtime() - start) / size : 0;
+        double tick_time = 0;
+        size_t events = 0;
+        for (int i = 0; i < ticks && error == IMPORT_OK; i++) {
+            start = omp_get_wtime();
+            map_update(&map);
+            const double elapsed = omp_get_wtime() - start;
+            if (elapsed > tick_time) tick_time = elapsed;
+            if (map.stats.events > events) events = map.stats.events;
+        }
+        printf("%s: %zu bytes (%s), import %.2f ns/byte, worst tick %.3f ms, %zu events, %zu chunks\n",
+                entry->d_name, size, import_error_string(error), byte_time * 1e9,
+                tick_time * 1e3, events, hmlenu(map.chunks));
+        if (tick_time > worst_tick) worst_tick = tick_time;
+        if (byte_time > worst_byte) worst_byte = byte_time;
+        if (events > worst_events) worst_events = events;
+        map_free(&map);
+        arrfree(input);
+    }
+    closedir(dir);
+    printf("worst: tick %.3f ms, %zu events per tick, import %.2f ns/byte\n",
+            worst_tick * 1e3, worst_events, worst_byte * 1e9);
+    return 0;
+}
@@ -0,0 +1,17 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+// usage: --bench-placement [maps file] [tiles] [ticks]
+int bench_placement(int argc, char **argv);
+// usage: --bench-import [maps file] [iterations]
+int bench_import(int argc, char **argv);
+// usage: --bench-export [maps file] [tiles]
+int bench_export(int argc, char **argv);
+// usage: --bench-pager [maps file] [tiles] [budget] [ticks] [page file, - for memory]
+int bench_pager(int argc, char **argv);
+// usage: --bench-codec [maps file] [iterations]
+int bench_codec(int argc, char **argv);
+// usage: --bench-worst [inputs directory] [ticks]
+int bench_worst(int argc, char **argv);
+
+#endif // BENCH_H
@@ -0,0 +1,63 @@
+#include <stdbool.h>
+#include <stdio.h>
+
+#include <string.h>
+
+#include "stb_ds.h"
+#include "map.h"
+#include "load.h"
+#include "snapshot.h"
+#include "autosave.h"
+
+char **load_quoted(const char *path) {
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        perror(path);
+        return NULL;
+    }
+    char **maps = NULL;
+    char *current = NULL;
+    bool quoted = false;
+    int c;
+    while ((c = fgetc(file)) != EOF) {
+        if (c == '"') {
+            if (quoted) {
+                arrput(current, '\0');
+                arrput(maps, current);
+                current = NULL;
+            }
+            quoted = !quoted;
+        } else if (quoted) {
+            arrput(current, c);
+        }
+    }
+    arrfree(current);
+    fclose(file);
+    return maps;
+}
+
+void free_quoted(char **strings) {
+    for (size_t i = 0; i < arrlenu(strings); i++) arrfree(strings[i]);
+    arrfree(strings);
+}
+
+bool load_map(map_t *map, const char *path) {
+    bool from_stdin = strcmp(path, "-") == 0;
+    if (!from_stdin && is_snapshot(path)) {
+        return map_snapshot_load(map, path);
+    }
+    if (!from_stdin && is_autosave(path)) {
+        return autosave_load(map, path);
+    }
+    FILE *file = from_stdin ? stdin : fopen(path, "r");
+    if (file == NULL) {
+        perror(path);
+        return false;
+    }
+    enum ImportError error = map_import_file(map, file);
+    bool failed = ferror(file);
+    if (failed) perror(path);
+    else if (error != IMPORT_OK) fprintf(stderr, "%s: %s\n", path, import_error_string(error));
+    if (!from_stdin) fclose(file);
+    return !failed && error == IMPORT_OK;
+}
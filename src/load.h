@@ -0,0 +1,16 @@
+#ifndef LOAD_H
+#define LOAD_H
+#include <stdbool.h>
+
+#include "map.h"
+
+// reads every "quoted" string from file, as in maps.txt,
+// returns stb_ds array of strings or NULL if file can't be opened
+char **load_quoted(const char *path);
+// frees result of load_quoted
+void free_quoted(char **strings);
+// imports base64 map from file, or from stdin if path is "-",
+// snapshots are recognized and loaded as they are
+bool load_map(map_t *map, const char *path);
+
+#endif // LOAD_H
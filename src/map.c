@@ -0,0 +1,1407 @@
+#if HAVE_NUMA
+// for sched_getcpu
+#define _GNU_SOURCE
+#endif // HAVE_NUMA
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+#if HAVE_NUMA
+#include <numa.h>
+#include <sched.h>
+#endif // HAVE_NUMA
+
+#define STB_DS_IMPLEMENTATION
+#include "stb_ds.h"
+#include "map.h"
+#include "base64.h"
+
+// minimal amount of work (in seconds) worth waking up one more thread for
+#define MIN_WORK_PER_THREAD 20e-6
+// weight of the last measurement in map_stats_t.chunk_cost
+#define CHUNK_COST_SMOOTHING 0.1
+// chunks are allocated in slabs of this size per node
+#define CHUNK_SLAB_SIZE 64
+#define MAP_RANDOM_SEED 0x9E3779B97F4A7C15ull
+// chunks taken by worker at once
+#define CHUNK_BATCH 4
+// eviction frees chunks down to this percent of pager budget,
+// so it doesn't have to run on every tick
+#define PAGER_LOW_WATER 90
+// when too few chunks are cold, the next scan waits this many
+// ticks, so busy maps don't pay for scanning every chunk each tick
+#define PAGER_RETRY_TICKS 64
+
+// returns node the calling thread is running on
+static int map_thread_node(map_t *map) {
+#if HAVE_NUMA
+    int node = numa_node_of_cpu(sched_getcpu());
+    if (node >= 0 && node < map->node_count) return node;
+#else
+    (void)map;
+#endif // HAVE_NUMA
+    return 0;
+}
+
+// chooses node for a new chunk
+static int map_pick_node(map_t *map) {
+    if (map->placement == PLACEMENT_INTERLEAVED)
+        return hmlenu(map->chunks) % map->node_count;
+    // keep nodes equally loaded
+    int best = 0;
+    for (int n = 1; n < map->node_count; n++) {
+        if (arrlenu(map->nodes[n].chunks) < arrlenu(map->nodes[best].chunks))
+            best = n;
+    }
+    return best;
+}
+
+// returned chunk lives in memory of given node, but isn't initialized
+static chunk_t* chunk_take(map_t *map, int node) {
+    numa_node_t *pool = &map->nodes[node];
+    if (arrlenu(pool->free) == 0) {
+        const size_t size = CHUNK_SLAB_SIZE * sizeof(chunk_t);
+#if HAVE_NUMA
+        chunk_t *slab = map->node_count > 1 ? numa_alloc_onnode(size, node) : malloc(size);
+#else
+        chunk_t *slab = malloc(size);
+#endif // HAVE_NUMA
+        assert(slab != NULL && "No RAM");
+        arrput(pool->slabs, slab);
+        for (size_t i = 0; i < CHUNK_SLAB_SIZE; i++) {
+            arrput(pool->free, &slab[CHUNK_SLAB_SIZE - 1 - i]);
+        }
+    }
+    return arrpop(pool->free);
+}
+
+// returned chunk is zeroed and lives in memory of given node
+static chunk_t* chunk_alloc(map_t *map, int node) {
+    chunk_t *chunk = chunk_take(map, node);
+    memset(chunk, 0, sizeof(*chunk));
+    chunk->node = node;
+    chunk->dirty = DIRTY_ALL;
+    chunk->last_active = map->pager.tick;
+    return chunk;
+}
+
+// chunk must not be in the map
+static void chunk_free(map_t *map, chunk_t *chunk) {
+    arrfree(chunk->update_queue);
+    arrput(map->nodes[chunk->node].free, chunk);
+}
+
+void map_init(map_t *map) {
+    map->max_threads = omp_get_max_threads();
+    map->random_state = MAP_RANDOM_SEED;
+    map->node_count = 1;
+#if HAVE_NUMA
+    if (numa_available() >= 0) {
+        map->node_count = numa_max_node() + 1;
+        if (map->node_count > MAX_NUMA_NODES) map->node_count = MAX_NUMA_NODES;
+    }
+#endif // HAVE_NUMA
+    map->edits = malloc(sizeof(*map->edits));
+    assert(map->edits != NULL && "No RAM");
+    for (size_t i = 0; i < EDIT_QUEUE_SIZE; i++) {
+        atomic_init(&map->edits->slots[i].sequence, i);
+    }
+    atomic_init(&map->edits->head, 0);
+    map->edits->tail = 0;
+}
+
+void map_free(map_t *map) {
+    for (size_t i = 0; i < hmlenu(map->chunks); i++) {
+        arrfree(map->chunks[i].value->update_queue);
+    }
+    hmfree(map->chunks);
+    for (int n = 0; n < map->node_count; n++) {
+        numa_node_t *node = &map->nodes[n];
+        for (size_t i = 0; i < arrlenu(node->slabs); i++) {
+#if HAVE_NUMA
+            if (map->node_count > 1) numa_free(node->slabs[i], CHUNK_SLAB_SIZE * sizeof(chunk_t));
+            else free(node->slabs[i]);
+#else
+            free(node->slabs[i]);
+#endif // HAVE_NUMA
+        }
+        arrfree(node->slabs);
+        arrfree(node->free);
+        arrfree(node->chunks);
+    }
+    pager_t *pager = &map->pager;
+    for (size_t i = 0; i < hmlenu(pager->chunks); i++) {
+        free(pager->chunks[i].value.data);
+    }
+    hmfree(pager->chunks);
+    for (size_t i = 0; i < PAGER_SLOT_CLASSES; i++) {
+        arrfree(pager->free[i]);
+    }
+    if (pager->file != NULL) fclose(pager->file);
+    arrfree(map->update_queue);
+    arrfree(map->outbox);
+    arrfree(map->changed);
+#if DEBUG
+    arrfree(map->debug);
+#endif // DEBUG
+    free(map->edits);
+    *map = (map_t){ 0 };
+}
+
+static void map_mark_changed(map_t *map, point_t key, chunk_t *chunk) {
+    if (!map->track_changes || chunk->changed) return;
+    chunk->changed = true;
+    arrput(map->changed, key);
+}
+
+void map_clear_changed(map_t *map) {
+    for (size_t i = 0; i < arrlenu(map->changed); i++) {
+        // chunk may be paged out by now
+        struct HashTable *kv = hmgetp_null(map->chunks, map->changed[i]);
+        if (kv != NULL) kv->value->changed = false;
+    }
+    arrsetlen(map->changed, 0);
+}
+
+void map_insert_chunk(map_t *map, point_t key, chunk_t *chunk) {
+    map_mark_changed(map, key, chunk);
+    hmput(map->chunks, key, chunk);
+    // interleaved placement schedules everything from one list,
+    // with one node chunk isn't read, so snapshot pages stay untouched
+    const bool local = map->placement == PLACEMENT_LOCAL && map->node_count > 1;
+    numa_node_t *list = &map->nodes[local ? chunk->node : 0];
+    arrput(list->chunks, hmlenu(map->chunks) - 1);
+}
+
+// needed after chunks were removed, hmdel moves last chunk into the hole
+static void map_rebuild_lists(map_t *map) {
+    for (int n = 0; n < map->node_count; n++) {
+        arrsetlen(map->nodes[n].chunks, 0);
+    }
+    for (size_t i = 0; i < hmlenu(map->chunks); i++) {
+        numa_node_t *list = &map->nodes[map->placement == PLACEMENT_LOCAL ? map->chunks[i].value->node : 0];
+        arrput(list->chunks, i);
+    }
+}
+
+// sum of per-cell hashes, so it doesn't depend on chunk order
+static uint64_t chunk_checksum(point_t key, const chunk_t *chunk) {
+    uint64_t sum = 0;
+    for (size_t j = 0; j < CHUNK_SIZE*CHUNK_SIZE; j++) {
+        const arrow_t *arrow = &chunk->arrows[j];
+        if (arrow->type == Empty) continue;
+        uint64_t h = (uint32_t)(key.x*CHUNK_SIZE + j % CHUNK_SIZE);
+        h = h << 32 | (uint32_t)(key.y*CHUNK_SIZE + j / CHUNK_SIZE);
+        h ^= (uint64_t)arrow->type << 8 ^ (uint64_t)arrow->signal << 16 ^ arrow->direction ^ (uint64_t)arrow->flipped << 4;
+        h *= 0x9E3779B97F4A7C15ull;
+        sum += h ^ (h >> 29);
+    }
+    return sum;
+}
+
+// occupied cells are stored as type in low 5 bits and direction
+// and flip above it, control byte below LAYOUT_LITERAL_MAX is
+// followed by control+1 literal cells, otherwise next cell is
+// repeated control-LAYOUT_REPEAT_BIAS times
+#define LAYOUT_BITMAP_SIZE (CHUNK_SIZE*CHUNK_SIZE/8)
+#define LAYOUT_LITERAL_MAX 128
+#define LAYOUT_REPEAT_BIAS 126
+// shorter runs are cheaper as part of literal
+#define LAYOUT_REPEAT_MIN 3
+
+size_t chunk_encode_layout(const chunk_t *chunk, uint8_t out[CHUNK_LAYOUT_MAX_SIZE]) {
+    uint8_t cells[CHUNK_SIZE*CHUNK_SIZE];
+    size_t count = 0;
+    memset(out, 0, LAYOUT_BITMAP_SIZE);
+    for (size_t i = 0; i < CHUNK_SIZE*CHUNK_SIZE; i++) {
+        const arrow_t *arrow = &chunk->arrows[i];
+        if (arrow->type == Empty) continue;
+        out[i / 8] |= 1 << (i % 8);
+        cells[count++] = arrow->type | (arrow->direction & 0b11) << 5 | (arrow->flipped ? 1 << 7 : 0);
+    }
+    if (count == 0) return 0;
+
+    size_t size = LAYOUT_BITMAP_SIZE;
+    for (size_t i = 0; i < count;) {
+        size_t run = 1;
+        while (i + run < count && run < 255 - LAYOUT_REPEAT_BIAS && cells[i + run] == cells[i]) run++;
+        if (run >= LAYOUT_REPEAT_MIN) {
+            out[size++] = run + LAYOUT_REPEAT_BIAS;
+            out[size++] = cells[i];
+            i += run;
+            continue;
+        }
+        size_t start = i;
+        while (i < count && i - start < LAYOUT_LITERAL_MAX &&
+                !(i + 2 < count && cells[i] == cells[i + 1] && cells[i] == cells[i + 2])) {
+            i++;
+        }
+        out[size++] = i - start - 1;
+        memcpy(out + size, cells + start, i - start);
+        size += i - start;
+    }
+    return size;
+}
+
+// chunk_update has no behaviour for Detector yet, so it's rejected
+// by loaders like unknown types instead of aborting on the first tick
+static bool cell_type_supported(uint8_t type) {
+    return type < MAX_CELL_TYPES && type != Detector;
+}
+
+bool chunk_decode_layout(const uint8_t *in, size_t size, chunk_t *chunk) {
+    memset(chunk->arrows, 0, sizeof(chunk->arrows));
+    if (size == 0) return true;
+    if (size < LAYOUT_BITMAP_SIZE || size > CHUNK_LAYOUT_MAX_SIZE) return false;
+    size_t total = 0;
+    for (size_t i = 0; i < LAYOUT_BITMAP_SIZE; i++) {
+        total += __builtin_popcount(in[i]);
+    }
+    uint8_t cells[CHUNK_SIZE*CHUNK_SIZE];
+    size_t count = 0, position = LAYOUT_BITMAP_SIZE;
+    while (count < total) {
+        if (position >= size) return false;
+        const uint8_t control = in[position++];
+        if (control < LAYOUT_LITERAL_MAX) {
+            const size_t run = control + 1;
+            if (run > total - count || position + run > size) return false;
+            memcpy(cells + count, in + position, run);
+            position += run;
+            count += run;
+        } else {
+            const size_t run = control - LAYOUT_REPEAT_BIAS;
+            if (run > total - count || position >= size) return false;
+            memset(cells + count, in[position++], run);
+            count += run;
+        }
+    }
+    if (position != size) return false;
+
+    count = 0;
+    for (size_t i = 0; i < CHUNK_SIZE*CHUNK_SIZE; i++) {
+        if (!(in[i / 8] >> (i % 8) & 1)) continue;
+        const uint8_t cell = cells[count++];
+        if (!cell_type_supported(cell & 0x1F)) return false;
+        chunk->arrows[i] = (arrow_t){
+            .type = cell & 0x1F,
+            .direction = cell >> 5 & 0b11,
+            .flipped = (cell >> 7) != 0,
+        };
+    }
+    return true;
+}
+
+void chunk_signal_image(const chunk_t *chunk, uint8_t out[CHUNK_SIZE*CHUNK_SIZE]) {
+    static const uint8_t colors[] = {
+        [S_RED] = SIGNAL_COLOR_RED,
+        [S_BLUE] = SIGNAL_COLOR_BLUE,
+        [S_YELLOW] = SIGNAL_COLOR_YELLOW,
+        [S_ORANGE] = SIGNAL_COLOR_ORANGE,
+        // block and delay state aren't visible
+        [S_DELAY_AFTER_RED] = SIGNAL_COLOR_NONE,
+    };
+    for (size_t i = 0; i < CHUNK_SIZE*CHUNK_SIZE; i++) {
+        const arrow_t *arrow = &chunk->arrows[i];
+        out[i] = arrow->type == Empty ? SIGNAL_COLOR_NONE : colors[arrow->signal];
+    }
+}
+
+bool map_pager_open(map_t *map, const char *path, size_t budget) {
+    FILE *file = NULL;
+    if (path != NULL && (file = fopen(path, "w+b")) == NULL) {
+        perror(path);
+        return false;
+    }
+    map->pager.file = file;
+    map->pager.budget = budget;
+    return true;
+}
+
+static void pager_read(pager_t *pager, const paged_chunk_t *paged, chunk_t *chunk) {
+    uint8_t layout[CHUNK_LAYOUT_MAX_SIZE];
+    const uint8_t *data = paged->data;
+    bool ok = true;
+    if (pager->file != NULL && paged->size > 0) {
+        ok = paged->size <= sizeof(layout) &&
+            fseek(pager->file, paged->offset, SEEK_SET) == 0 &&
+            fread(layout, 1, paged->size, pager->file) == paged->size;
+        data = layout;
+    }
+    ok = ok && chunk_decode_layout(data, paged->size, chunk);
+    assert(ok && "Pager file is broken");
+}
+
+// stores compressed layout of paged out chunk, in file or in memory
+static bool pager_write(pager_t *pager, paged_chunk_t *paged, const uint8_t *layout) {
+    if (paged->size == 0) return true;
+    if (pager->file == NULL) {
+        paged->data = malloc(paged->size);
+        assert(paged->data != NULL && "No RAM");
+        memcpy(paged->data, layout, paged->size);
+        return true;
+    }
+    const size_t class = (paged->size + PAGER_SLOT_SIZE - 1) / PAGER_SLOT_SIZE;
+    if (arrlenu(pager->free[class]) > 0) {
+        paged->offset = arrpop(pager->free[class]);
+    } else {
+        paged->offset = pager->file_size;
+        pager->file_size += class * PAGER_SLOT_SIZE;
+    }
+    if (fseek(pager->file, paged->offset, SEEK_SET) != 0 ||
+            fwrite(layout, 1, paged->size, pager->file) != paged->size) {
+        perror("pager");
+        arrput(pager->free[class], paged->offset);
+        return false;
+    }
+    return true;
+}
+
+static void pager_release(pager_t *pager, paged_chunk_t *paged) {
+    if (paged->size == 0) return;
+    if (pager->file == NULL) {
+        free(paged->data);
+    } else {
+        arrput(pager->free[(paged->size + PAGER_SLOT_SIZE - 1) / PAGER_SLOT_SIZE], paged->offset);
+    }
+}
+
+void map_paged_read(map_t *map, size_t i, chunk_t *chunk) {
+    memset(chunk, 0, sizeof(*chunk));
+    pager_read(&map->pager, &map->pager.chunks[i].value, chunk);
+    chunk->unload_timer = UNLOAD_TIMER_MAX;
+    chunk->dirty = map->pager.chunks[i].value.dirty;
+}
+
+// brings paged out chunk back, returns NULL if there is no such chunk
+static struct HashTable* map_fault(map_t *map, point_t key) {
+    pager_t *pager = &map->pager;
+    struct PagedChunk *paged = hmgetp_null(pager->chunks, key);
+    if (paged == NULL) return NULL;
+    chunk_t *chunk = chunk_alloc(map, map_pick_node(map));
+    pager_read(pager, &paged->value, chunk);
+    // it was cold, so it's skipped until event or edit reaches it
+    chunk->unload_timer = UNLOAD_TIMER_MAX;
+    chunk->dirty = paged->value.dirty;
+    pager->bytes -= paged->value.size;
+    pager_release(pager, &paged->value);
+    (void)hmdel(pager->chunks, key);
+    pager->faults++;
+    map_insert_chunk(map, key, chunk);
+    return &map->chunks[hmlenu(map->chunks) - 1];
+}
+
+// paged out chunk is faulted in, returns NULL if chunk doesn't exist
+static struct HashTable* map_lookup(map_t *map, point_t key) {
+    struct HashTable *kv = hmgetp_null(map->chunks, key);
+    if (kv == NULL && map->pager.budget > 0) kv = map_fault(map, key);
+    return kv;
+}
+
+// no signals, no events and nothing happened for a while,
+// so whole state of the chunk is it's layout
+static bool chunk_is_cold(const chunk_t *chunk) {
+    if (chunk->unload_timer < UNLOAD_TIMER_MAX || arrlenu(chunk->update_queue) > 0)
+        return false;
+    for (size_t i = 0; i < CHUNK_SIZE*CHUNK_SIZE; i++) {
+        if (chunk->arrows[i].signal != S_NONE || chunk->arrows[i].signal_count != 0)
+            return false;
+    }
+    return true;
+}
+
+typedef struct {
+    uint32_t last_active;
+    size_t index;
+} eviction_t;
+
+static int eviction_compare(const void *a, const void *b) {
+    const eviction_t *x = a, *y = b;
+    if (x->last_active != y->last_active) return x->last_active < y->last_active ? -1 : 1;
+    return x->index < y->index ? -1 : x->index > y->index;
+}
+
+// pages out least recently active cold chunks until
+// chunks in memory fit into budget
+static void map_evict(map_t *map) {
+    pager_t *pager = &map->pager;
+    const size_t resident = hmlenu(map->chunks);
+    if (pager->budget == 0 || resident <= pager->budget) return;
+    if ((int32_t)(pager->tick - pager->next_scan) < 0) return;
+    eviction_t *candidates = NULL;
+    for (size_t i = 0; i < resident; i++) {
+        if (!chunk_is_cold(map->chunks[i].value)) continue;
+        arrput(candidates, ((eviction_t){ .last_active = map->chunks[i].value->last_active, .index = i }));
+    }
+    size_t count = resident - pager->budget * PAGER_LOW_WATER / 100;
+    if (count > arrlenu(candidates)) {
+        count = arrlenu(candidates);
+        pager->next_scan = pager->tick + PAGER_RETRY_TICKS;
+    }
+    if (candidates == NULL) return;
+    qsort(candidates, arrlenu(candidates), sizeof(*candidates), eviction_compare);
+
+    point_t *evicted = NULL;
+    uint8_t layout[CHUNK_LAYOUT_MAX_SIZE];
+    for (size_t i = 0; i < count; i++) {
+        const struct HashTable *kv = &map->chunks[candidates[i].index];
+        paged_chunk_t paged = {
+            .size = chunk_encode_layout(kv->value, layout),
+            .dirty = kv->value->dirty,
+            .checksum = chunk_checksum(kv->key, kv->value),
+        };
+        // disk is full, rest stays in memory
+        if (!pager_write(pager, &paged, layout)) break;
+        pager->bytes += paged.size;
+        hmput(pager->chunks, kv->key, paged);
+        arrput(evicted, kv->key);
+    }
+    for (size_t i = 0; i < arrlenu(evicted); i++) {
+        chunk_t *chunk = hmget(map->chunks, evicted[i]);
+        (void)hmdel(map->chunks, evicted[i]);
+        chunk_free(map, chunk);
+    }
+    if (arrlenu(evicted) > 0) map_rebuild_lists(map);
+    pager->evictions += arrlenu(evicted);
+    arrfree(evicted);
+    arrfree(candidates);
+}
+
+chunk_t* map_get_chunk(map_t *map, int32_t x, int32_t y) {
+    struct HashTable *kv = map_lookup(map, pos2chunk(x, y));
+    if (kv == NULL) {
+        chunk_t *chunk = chunk_alloc(map, map_pick_node(map));
+        map_insert_chunk(map, pos2chunk(x, y), chunk);
+        return chunk;
+    }
+    return kv->value;
+}
+
+arrow_t* map_get(map_t *map, int32_t x, int32_t y) {
+    chunk_t *chunk = map_get_chunk(map, x, y);
+    return &chunk->arrows[pos2index(x, y)];
+}
+
+arrow_t* map_find(map_t *map, int32_t x, int32_t y) {
+    struct HashTable *kv = map_lookup(map, pos2chunk(x, y));
+    if (kv == NULL) return NULL;
+    return &kv->value->arrows[pos2index(x, y)];
+}
+
+void map_power(map_t *map, chunk_t *chunk, int x, int y) {
+    if (chunk != NULL) {
+        arrput(chunk->update_queue, ((queue_t){ .type = QT_POWER, .position = (point_t){.x = x, .y = y }}));
+    } else {
+        arrput(map->update_queue, ((queue_t){ .type = QT_POWER, .position = (point_t){.x = x, .y = y }}));
+    }
+}
+
+void map_block(map_t *map, chunk_t *chunk, int x, int y) {
+    if (chunk != NULL) {
+        arrput(chunk->update_queue, ((queue_t){ .type = QT_BLOCK, .position = (point_t){.x = x, .y = y }}));
+    } else {
+        arrput(map->update_queue, ((queue_t){ .type = QT_BLOCK, .position = (point_t){.x = x, .y = y }}));
+    }
+}
+
+// xorshift64*, state is part of the map so runs are reproducible
+static uint64_t map_random(map_t *map) {
+    map->random_state ^= map->random_state >> 12;
+    map->random_state ^= map->random_state << 25;
+    map->random_state ^= map->random_state >> 27;
+    return map->random_state * 0x2545F4914F6CDD1Dull;
+}
+
+void arrow_power(map_t *map, arrow_t *arrow, enum QueueType type) {
+    switch (type) {
+        case QT_BLOCK:
+            arrow->signal = S_BLOCK;
+            arrow->signal_count = 0;
+            break;
+        case QT_POWER:
+            if (arrow->signal == S_BLOCK) break;
+            arrow->signal_count++;
+
+            switch(arrow->type) {
+                case Empty:
+                    break;
+                case Arrow:
+                    arrow->signal = S_RED;
+                    break;
+                case Source:
+                    break;
+                case Blocker:
+                    arrow->signal = S_RED;
+                    break;
+                case Delay:
+                    if (arrow->signal == S_NONE || arrow->signal == S_BLOCK)
+                        arrow->signal = S_BLUE;
+                    else
+                        arrow->signal = S_RED;
+                    break;
+                case Detector:
+                    break;
+                case SplitterUpDown:
+                    arrow->signal = S_RED;
+                    break;
+                case SplitterUpRight:
+                    arrow->signal = S_RED;
+                    break;
+                case SplitterUpRightLeft:
+                    arrow->signal = S_RED;
+                    break;
+                case Pulse:
+                    break;
+                case BlueArrow:
+                    arrow->signal = S_BLUE;
+                    break;
+                case Diagonal:
+                    arrow->signal = S_BLUE;
+                    break;
+                case BlueSplitterUpUp:
+                    arrow->signal = S_BLUE;
+                    break;
+                case BlueSplitterRightUp:
+                    arrow->signal = S_BLUE;
+                    break;
+                case BlueSplitterUpDiagonal:
+                    arrow->signal = S_BLUE;
+                    break;
+                case Not:
+                    arrow->signal = S_NONE;
+                    break;
+                case And:
+                    arrow->signal = arrow->signal_count >= 2 ? S_YELLOW : S_NONE;
+                    break;
+                case Xor:
+                    arrow->signal = arrow->signal_count % 2 != 0 ? S_YELLOW : S_NONE;
+                    break;
+                case Latch:
+                    arrow->signal = arrow->signal_count >= 2 ? S_YELLOW : S_NONE;
+                    break;
+                case Flipflop:
+                    if(arrow->signal_count > 1) { break; }
+                    arrow->signal = arrow->signal == S_NONE ? S_YELLOW : S_NONE;
+                    break;
+                case Random:
+                    arrow->signal = map_random(map) >> 32 & 1;
+                    break;
+                case Button:
+                    break;
+                case LevelSource:
+                    break;
+                case LevelTarget:
+                    break;
+                case DirectoinalButton:
+                    arrow->signal = S_ORANGE;
+                    break;
+            }
+            break;
+    }
+
+}
+
+// events for chunks of other processes go to outbox
+static void map_apply_event(map_t *map, queue_t q) {
+    if (map->partition != NULL &&
+            partition_owner(map->partition, pos2chunk(q.position.x, q.position.y).x) != map->partition->rank) {
+        arrput(map->outbox, q);
+        return;
+    }
+    chunk_t *chunk = map_get_chunk(map, q.position.x, q.position.y);
+    chunk->unload_timer = 0;
+    chunk->last_active = map->pager.tick;
+    chunk->dirty |= DIRTY_SIGNAL_BITS;
+    map_mark_changed(map, pos2chunk(q.position.x, q.position.y), chunk);
+    arrow_t *arrow = map_get(map, q.position.x, q.position.y);
+    arrow_power(map, arrow, q.type);
+}
+
+void map_apply_events(map_t *map, const queue_t *events, size_t count) {
+    for(size_t i = 0; i < count; i++) {
+        map_apply_event(map, events[i]);
+    }
+}
+
+void map_queue_update(map_t *map) {
+    const size_t qlen = arrlenu(map->update_queue);
+    size_t events = qlen;
+    for(size_t i = 0; i < qlen; i++) {
+        map_apply_event(map, map->update_queue[i]);
+    }
+    arrsetlen(map->update_queue, 0);
+    for(size_t chunk_i = 0; chunk_i < hmlenu(map->chunks); chunk_i++) {
+        const size_t qlen = arrlenu(map->chunks[chunk_i].value->update_queue);
+        if (qlen <= 0) continue;
+        events += qlen;
+        arrsetlen(map->chunks[chunk_i].value->update_queue, 0);
+        for(size_t i = 0; i < qlen; i++) {
+            map_apply_event(map, map->chunks[chunk_i].value->update_queue[i]);
+        }
+    }
+    map->stats.events = events;
+}
+
+uint64_t map_checksum(map_t *map) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < hmlenu(map->chunks); i++) {
+        sum += chunk_checksum(map->chunks[i].key, map->chunks[i].value);
+    }
+    for (size_t i = 0; i < hmlenu(map->pager.chunks); i++) {
+        sum += map->pager.chunks[i].value.checksum;
+    }
+    return sum;
+}
+
+// base64 text is decoded in blocks of this many characters,
+// so imported maps never have to be in memory as a whole
+#define IMPORT_BLOCK_SIZE 4096
+// chunks decoded at once by map_import
+#define IMPORT_BATCH_SIZE 4096
+// smaller batches are decoded on the calling thread
+#define IMPORT_PARALLEL_MIN 64
+
+typedef struct {
+    // source is file if it's not NULL, otherwise string
+    FILE *file;
+    const char *string;
+    bool eof;
+    // base64 text which wasn't decoded yet
+    char text[IMPORT_BLOCK_SIZE];
+    size_t text_size;
+    uint8_t bytes[BASE64_DECODED_SIZE(IMPORT_BLOCK_SIZE)];
+    size_t size, index;
+    // set by the first failed read, later reads return zeros
+    enum ImportError error;
+} import_reader_t;
+
+static bool is_base64_space(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+// decodes next block, returns false if there is nothing left
+static bool import_refill(import_reader_t *reader) {
+    while (!reader->eof && reader->text_size < IMPORT_BLOCK_SIZE) {
+        size_t read;
+        char *to = reader->text + reader->text_size;
+        const size_t space = IMPORT_BLOCK_SIZE - reader->text_size;
+        if (reader->file != NULL) {
+            read = fread(to, 1, space, reader->file);
+            reader->eof = read < space;
+        } else {
+            read = strnlen(reader->string, space);
+            memcpy(to, reader->string, read);
+            reader->string += read;
+            reader->eof = *reader->string == '\0';
+        }
+        // whitespace and newlines are allowed anywhere in files
+        for (size_t i = 0; i < read; i++) {
+            if (!is_base64_space(to[i]))
+                reader->text[reader->text_size++] = to[i];
+        }
+    }
+    // only the last block may end with incomplete group
+    size_t length = reader->eof ? reader->text_size : reader->text_size / 4 * 4;
+    if (length == 0) return false;
+    ptrdiff_t decoded = base64_decode(reader->text, length, reader->bytes);
+    if (decoded < 0) {
+        reader->error = IMPORT_INVALID_BASE64;
+        return false;
+    }
+    memmove(reader->text, reader->text + length, reader->text_size - length);
+    reader->text_size -= length;
+    reader->size = decoded;
+    reader->index = 0;
+    return decoded > 0;
+}
+
+static bool import_fail(import_reader_t *reader, enum ImportError error) {
+    if (reader->error == IMPORT_OK) reader->error = error;
+    return false;
+}
+
+static inline uint8_t import_pop8(import_reader_t *reader) {
+    if (reader->index >= reader->size &&
+            (reader->error != IMPORT_OK || !import_refill(reader))) {
+        import_fail(reader, IMPORT_TRUNCATED);
+        return 0;
+    }
+    return reader->bytes[reader->index++];
+}
+
+static inline uint16_t import_pop16(import_reader_t *reader) {
+    uint16_t low = import_pop8(reader);
+    return low | (uint16_t)import_pop8(reader) << 8;
+}
+
+static bool import_copy(import_reader_t *reader, uint8_t *to, size_t size) {
+    while (size > 0) {
+        if (reader->index >= reader->size &&
+                (reader->error != IMPORT_OK || !import_refill(reader))) {
+            return import_fail(reader, IMPORT_TRUNCATED);
+        }
+        size_t available = reader->size - reader->index;
+        size_t count = available < size ? available : size;
+        memcpy(to, reader->bytes + reader->index, count);
+        reader->index += count;
+        to += count;
+        size -= count;
+    }
+    return true;
+}
+
+// chunk read by the first pass, decoded by the second one
+typedef struct {
+    point_t key;
+    // where it's types start in import_batch_t.bytes
+    size_t offset;
+    chunk_t *chunk;
+} import_chunk_t;
+
+typedef struct {
+    import_chunk_t *chunks;
+    uint8_t *bytes;
+} import_batch_t;
+
+// takes chunk body without coordinates, cells are grouped
+// by type as described in map_import_from, and already validated
+static void import_decode_chunk(const uint8_t *bytes, chunk_t *chunk) {
+    int types_count = *bytes++ + 1;
+    for (int _type = 0; _type < types_count; _type++) {
+        uint8_t arrow_type = *bytes++;
+        int arrow_count = *bytes++ + 1;
+        for (int _arrow = 0; _arrow < arrow_count; _arrow++) {
+            // (y << 4) | x, which is cell index in 16x16 chunk
+            uint8_t position = *bytes++;
+            uint8_t direction_and_flip = *bytes++;
+            arrow_t *arrow = &chunk->arrows[position];
+            arrow->direction = direction_and_flip & 0b11;
+            arrow->flipped = (direction_and_flip & 0b100) != 0;
+            arrow->type = arrow_type;
+        }
+    }
+}
+
+// decodes every chunk of batch in parallel and inserts them into map
+static void import_flush(map_t *map, import_batch_t *batch) {
+    const size_t count = arrlenu(batch->chunks);
+    const size_t chunks_before = hmlenu(map->chunks);
+    for (size_t i = 0; i < count; i++) {
+        int node = (chunks_before + i) % map->node_count;
+        batch->chunks[i].chunk = chunk_take(map, node);
+        batch->chunks[i].chunk->node = node;
+    }
+    const int threads = count >= IMPORT_PARALLEL_MIN ? map->max_threads : 1;
+#pragma omp parallel for schedule(dynamic, 16) num_threads(threads) if(threads > 1)
+    for (size_t i = 0; i < count; i++) {
+        chunk_t *chunk = batch->chunks[i].chunk;
+        int node = chunk->node;
+        memset(chunk, 0, sizeof(*chunk));
+        chunk->node = node;
+        chunk->dirty = DIRTY_ALL;
+        chunk->last_active = map->pager.tick;
+        import_decode_chunk(batch->bytes + batch->chunks[i].offset, chunk);
+    }
+    for (size_t i = 0; i < count; i++) {
+        chunk_t *chunk = batch->chunks[i].chunk;
+        struct HashTable *kv = map_lookup(map, batch->chunks[i].key);
+        if (kv == NULL) {
+            map_insert_chunk(map, batch->chunks[i].key, chunk);
+            continue;
+        }
+        // chunk is already in the map, so only new cells are taken
+        for (size_t j = 0; j < CHUNK_SIZE*CHUNK_SIZE; j++) {
+            const arrow_t *arrow = &chunk->arrows[j];
+            if (arrow->type == Empty) continue;
+            kv->value->arrows[j].type = arrow->type;
+            kv->value->arrows[j].direction = arrow->direction;
+            kv->value->arrows[j].flipped = arrow->flipped;
+        }
+        kv->value->dirty = DIRTY_ALL;
+        chunk_free(map, chunk);
+    }
+    arrsetlen(batch->chunks, 0);
+    arrsetlen(batch->bytes, 0);
+}
+
+// format:
+//   u16 version, u16 chunk count, then for every chunk
+//   i16 x, i16 y, u8 types count - 1, then for every type
+//   u8 type, u8 cells count - 1, then for every cell
+//   u8 position (y << 4 | x), u8 direction | flipped << 2
+// all numbers are little-endian
+//
+// first pass only walks headers to find where chunks end, validates
+// them and copies them into a batch, second pass decodes whole batch
+// in parallel
+static enum ImportError map_import_from(map_t *map, import_reader_t *reader) {
+    import_batch_t batch = { 0 };
+
+    const uint16_t version = import_pop16(reader);
+    const uint16_t chunk_count = import_pop16(reader);
+    if (reader->error == IMPORT_OK && version > MAP_VERSION)
+        import_fail(reader, IMPORT_UNSUPPORTED_VERSION);
+    for (uint16_t _chunk = 0; _chunk < chunk_count && reader->error == IMPORT_OK; _chunk++) {
+        // initializers are unsequenced, so x has to be popped first
+        const int16_t x = (int16_t)import_pop16(reader);
+        const int16_t y = (int16_t)import_pop16(reader);
+        import_chunk_t chunk = {
+            .key.x = x,
+            .key.y = y,
+            .offset = arrlenu(batch.bytes),
+        };
+        uint8_t types_count = import_pop8(reader);
+        arrput(batch.bytes, types_count);
+        for (int _type = 0; _type < types_count + 1 && reader->error == IMPORT_OK; _type++) {
+            uint8_t *type = arraddnptr(batch.bytes, 2);
+            if (!import_copy(reader, type, 2)) break;
+            if (!cell_type_supported(type[0])) {
+                import_fail(reader, IMPORT_INVALID_TYPE);
+                break;
+            }
+            const size_t cells_size = 2 * ((size_t)type[1] + 1);
+            uint8_t *cells = arraddnptr(batch.bytes, cells_size);
+            if (!import_copy(reader, cells, cells_size)) break;
+            for (size_t i = 1; i < cells_size; i += 2) {
+                if (cells[i] > 0b111) {
+                    import_fail(reader, IMPORT_INVALID_CELL);
+                    break;
+                }
+            }
+        }
+        if (reader->error != IMPORT_OK) break;
+        arrput(batch.chunks, chunk);
+        if (arrlenu(batch.chunks) >= IMPORT_BATCH_SIZE)
+            import_flush(map, &batch);
+    }
+    import_flush(map, &batch);
+    arrfree(batch.chunks);
+    arrfree(batch.bytes);
+    if (reader->error == IMPORT_OK) map->version = version;
+    return reader->error;
+}
+
+enum ImportError map_import(map_t *map, const char *input) {
+    import_reader_t *reader = calloc(1, sizeof(*reader));
+    assert(reader != NULL && "No RAM");
+    reader->string = input;
+    enum ImportError error = map_import_from(map, reader);
+    free(reader);
+    return error;
+}
+
+enum ImportError map_import_file(map_t *map, FILE *file) {
+    import_reader_t *reader = calloc(1, sizeof(*reader));
+    assert(reader != NULL && "No RAM");
+    reader->file = file;
+    enum ImportError error = map_import_from(map, reader);
+    free(reader);
+    return error;
+}
+
+const char* import_error_string(enum ImportError error) {
+    switch (error) {
+        case IMPORT_OK: return "ok";
+        case IMPORT_INVALID_BASE64: return "invalid base64";
+        case IMPORT_TRUNCATED: return "unexpected end of map";
+        case IMPORT_UNSUPPORTED_VERSION: return "map is from newer version";
+        case IMPORT_INVALID_TYPE: return "unknown cell type";
+        case IMPORT_INVALID_CELL: return "invalid cell direction";
+    }
+    return "unknown error";
+}
+
+bool map_edit(map_t *map, edit_t edit) {
+    edit_queue_t *queue = map->edits;
+    size_t position = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    for (;;) {
+        struct EditSlot *slot = &queue->slots[position & (EDIT_QUEUE_SIZE - 1)];
+        size_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)sequence - (intptr_t)position;
+        if (diff == 0) {
+            // on failure position is reloaded and we try next slot
+            if (atomic_compare_exchange_weak_explicit(&queue->head, &position, position + 1,
+                        memory_order_relaxed, memory_order_relaxed)) {
+                slot->edit = edit;
+                atomic_store_explicit(&slot->sequence, position + 1, memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            // consumer hasn't freed this slot yet
+            return false;
+        } else {
+            position = atomic_load_explicit(&queue->head, memory_order_relaxed);
+        }
+    }
+}
+
+static void map_layout_changed(map_t *map, int32_t x, int32_t y) {
+    chunk_t *chunk = map_get_chunk(map, x, y);
+    chunk->dirty = DIRTY_ALL;
+    map_mark_changed(map, pos2chunk(x, y), chunk);
+}
+
+static void map_apply_edit(map_t *map, edit_t edit) {
+    int x = edit.position.x, y = edit.position.y;
+    switch (edit.type) {
+        case E_PLACE: {
+            chunk_t *chunk = map_get_chunk(map, x, y);
+            chunk->unload_timer = 0;
+            chunk->last_active = map->pager.tick;
+            map_layout_changed(map, x, y);
+            *map_get(map, x, y) = (arrow_t){
+                .type = edit.cell,
+                .direction = edit.direction,
+                .flipped = edit.flipped,
+            };
+        } break;
+        case E_REMOVE: {
+            arrow_t *arrow = map_find(map, x, y);
+            if (arrow == NULL || arrow->type == Empty) break;
+            *arrow = (arrow_t){ 0 };
+            map_layout_changed(map, x, y);
+        } break;
+        case E_ROTATE: {
+            arrow_t *arrow = map_find(map, x, y);
+            if (arrow == NULL || arrow->type == Empty || arrow->direction == edit.direction) break;
+            arrow->direction = edit.direction;
+            map_layout_changed(map, x, y);
+        } break;
+        case E_FLIP: {
+            arrow_t *arrow = map_find(map, x, y);
+            if (arrow == NULL || arrow->type == Empty) break;
+            arrow->flipped = !arrow->flipped;
+            map_layout_changed(map, x, y);
+        } break;
+        case E_INTERACT: {
+            arrow_t *arrow = map_find(map, x, y);
+            // FIXME: doesn't work for Button
+            if (arrow != NULL && (arrow->type == Button || arrow->type == DirectoinalButton)) {
+                map_power(map, NULL, x, y);
+            }
+        } break;
+    }
+}
+
+void map_apply_edits(map_t *map) {
+    edit_queue_t *queue = map->edits;
+    for (;;) {
+        struct EditSlot *slot = &queue->slots[queue->tail & (EDIT_QUEUE_SIZE - 1)];
+        size_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        // producer hasn't finished writing this slot yet
+        if (sequence != queue->tail + 1) break;
+        edit_t edit = slot->edit;
+        atomic_store_explicit(&slot->sequence, queue->tail + EDIT_QUEUE_SIZE, memory_order_release);
+        queue->tail++;
+        map_apply_edit(map, edit);
+    }
+}
+
+static bool export_key_fits(point_t key) {
+    return key.x >= INT16_MIN && key.x <= INT16_MAX && key.y >= INT16_MIN && key.y <= INT16_MAX;
+}
+
+// writes version, chunk count and every non-empty chunk in map_import format
+static bool map_export_to(map_t *map, base64_writer_t *writer) {
+    size_t chunk_count = 0;
+    for (size_t i = 0; i < hmlenu(map->chunks); i++) {
+        const chunk_t *chunk = map->chunks[i].value;
+        for (size_t j = 0; j < CHUNK_SIZE*CHUNK_SIZE; j++) {
+            if (chunk->arrows[j].type != Empty) {
+                if (!export_key_fits(map->chunks[i].key)) return false;
+                chunk_count++;
+                break;
+            }
+        }
+    }
+    for (size_t i = 0; i < hmlenu(map->pager.chunks); i++) {
+        if (map->pager.chunks[i].value.size == 0) continue;
+        if (!export_key_fits(map->pager.chunks[i].key)) return false;
+        chunk_count++;
+    }
+    if (chunk_count > UINT16_MAX) return false;
+
+    // largest chunk: header, every type once and 2 bytes per cell
+    uint8_t buffer[4 + 1 + 2*MAX_CELL_TYPES + 2*CHUNK_SIZE*CHUNK_SIZE];
+    size_t size = 0;
+#define push8(value) (buffer[size++] = (uint8_t)(value))
+#define push16(value) (push8((value) & 0xFF), push8(((value) >> 8) & 0xFF))
+    push16(map->version);
+    push16(chunk_count);
+    base64_write(writer, buffer, size);
+
+    const size_t resident = hmlenu(map->chunks);
+    chunk_t paged;
+    for (size_t i = 0; i < resident + hmlenu(map->pager.chunks); i++) {
+        point_t key;
+        const chunk_t *chunk;
+        if (i < resident) {
+            key = map->chunks[i].key;
+            chunk = map->chunks[i].value;
+        } else {
+            // read without faulting in, so export doesn't undo eviction
+            key = map->pager.chunks[i - resident].key;
+            if (map->pager.chunks[i - resident].value.size == 0) continue;
+            map_paged_read(map, i - resident, &paged);
+            chunk = &paged;
+        }
+        uint16_t type_counts[MAX_CELL_TYPES] = { 0 };
+        int types_count = 0;
+        for (size_t j = 0; j < CHUNK_SIZE*CHUNK_SIZE; j++) {
+            enum CellType type = chunk->arrows[j].type;
+            if (type == Empty) continue;
+            types_count += type_counts[type] == 0;
+            type_counts[type]++;
+        }
+        if (types_count == 0) continue;
+
+        size = 0;
+        push16((uint16_t)key.x);
+        push16((uint16_t)key.y);
+        push8(types_count - 1);
+        for (int type = 0; type < MAX_CELL_TYPES; type++) {
+            if (type_counts[type] == 0) continue;
+            push8(type);
+            push8(type_counts[type] - 1);
+            for (size_t j = 0; j < CHUNK_SIZE*CHUNK_SIZE; j++) {
+                const arrow_t *arrow = &chunk->arrows[j];
+                if (arrow->type != (enum CellType)type) continue;
+                // cell index is (y << 4) | x as long as chunks are 16x16
+                push8(j);
+                push8((arrow->direction & 0b11) | (arrow->flipped ? 0b100 : 0));
+            }
+        }
+        base64_write(writer, buffer, size);
+    }
+#undef push8
+#undef push16
+    return true;
+}
+
+char* map_export(map_t *map) {
+    base64_writer_t writer = { 0 };
+    if (!map_export_to(map, &writer)) {
+        arrfree(writer.string);
+        return NULL;
+    }
+    base64_finish(&writer);
+    return writer.string;
+}
+
+bool map_export_file(map_t *map, FILE *file) {
+    base64_writer_t writer = { .file = file };
+    if (!map_export_to(map, &writer)) return false;
+    return base64_finish(&writer);
+}
+
+// picks number of threads for the next tick, waking threads up
+// costs more than updating a handful of chunks, so small
+// workloads are done on the calling thread
+int map_choose_threads(map_t *map, size_t active_chunks) {
+    if (active_chunks <= 1 || map->max_threads <= 1)
+        return 1;
+    // no measurements yet, so let the first tick show how expensive chunks are
+    if (map->stats.chunk_cost <= 0)
+        return 1;
+    double work = map->stats.chunk_cost * active_chunks;
+    int threads = work / MIN_WORK_PER_THREAD;
+    if (threads > map->max_threads) threads = map->max_threads;
+    if ((size_t)threads > active_chunks) threads = active_chunks;
+    if (threads < 1) threads = 1;
+    return threads;
+}
+
+static void chunk_update(map_t *map, struct HashTable *kv) {
+    chunk_t *chunk = kv->value;
+#if DEBUG
+    // every chunk has it's own entry, so workers don't share them
+    chunk_debug_t *debug = &map->debug[kv - map->chunks];
+    *debug = (chunk_debug_t){ .key = kv->key, .unload_timer = chunk->unload_timer, .thread = -1 };
+#endif // DEBUG
+    if (chunk->unload_timer >= UNLOAD_TIMER_MAX)
+        return;
+    chunk->unload_timer++;
+    // only this thread touches the chunk
+    chunk->dirty |= DIRTY_SIGNAL_BITS;
+    int32_t  chunk_x = kv->key.x,
+             chunk_y = kv->key.y;
+#if DEBUG
+    debug->unload_timer = chunk->unload_timer;
+    debug->thread = omp_get_thread_num();
+#endif // DEBUG
+    static const int updates_straight[4][2] = {
+        [D_NORTH]  = { 0, -1},
+        [D_EAST]   = { 1,  0},
+        [D_SOUTH]  = { 0,  1},
+        [D_WEST]   = {-1,  0},
+    };
+    static const int updates_diagonal[4][2] = {
+        [D_NORTH]  = { 1, -1},
+        [D_EAST]   = { 1,  1},
+        [D_SOUTH]  = {-1,  1},
+        [D_WEST]   = {-1, -1},
+    };
+    for(size_t j = 0; j < CHUNK_SIZE*CHUNK_SIZE; j++) {
+        int arrow_x = chunk_x * CHUNK_SIZE + j % CHUNK_SIZE;
+        int arrow_y = chunk_y * CHUNK_SIZE + j / CHUNK_SIZE;
+        arrow_t *arrow = &chunk->arrows[j];
+        switch(arrow->type) {
+            case Empty:
+                break;
+            case Arrow:
+                if(arrow->signal != S_RED) {
+                    arrow->signal = S_NONE;
+                    break;
+                }
+                map_power(map, chunk, arrow_x+updates_straight[arrow->direction][0], arrow_y + updates_straight[arrow->direction][1]);
+                arrow->signal = S_NONE;
+                break;
+            case Source:
+                if(arrow->signal != S_RED) {
+                    arrow->signal = S_RED;
+                    break;
+                }
+                map_power(map, chunk, arrow_x+1, arrow_y);
+                map_power(map, chunk, arrow_x-1, arrow_y);
+                map_power(map, chunk, arrow_x  , arrow_y+1);
+                map_power(map, chunk, arrow_x  , arrow_y-1);
+                break;
+            case Blocker:
+                if(arrow->signal != S_RED) {
+                    arrow->signal = S_NONE;
+                    break;
+                }
+                map_block(map, chunk, arrow_x+updates_straight[arrow->direction][0], arrow_y + updates_straight[arrow->direction][1]);
+                arrow->signal = S_NONE;
+                break;
+            case Delay:
+                switch(arrow->signal) {
+                    case S_BLOCK:
+                    case S_DELAY_AFTER_RED:
+                        arrow->signal = S_NONE;
+                        break;
+                    case S_NONE:
+                        break;
+                    case S_BLUE:
+                        arrow->signal = S_RED;
+                        break;
+                    case S_RED:
+                        map_power(map, chunk, arrow_x+updates_straight[arrow->direction][0], arrow_y + updates_straight[arrow->direction][1]);
+                        arrow->signal = S_DELAY_AFTER_RED;
+                        break;
+                    case S_YELLOW:
+                    case S_ORANGE:
+                        break;
+                }
+                break;
+            case Detector:
+                assert(false && "Detector is evil");
+                break;
+            case SplitterUpDown:
+                if(arrow->signal != S_RED) {
+                    arrow->signal = S_NONE;
+                    break;
+                }
+                map_power(map, chunk, arrow_x+updates_straight[arrow->direction][0], arrow_y + updates_straight[arrow->direction][1]);
+                map_power(map, chunk, arrow_x+updates_straight[(arrow->direction + 2) % 4][0], arrow_y + updates_straight[(arrow->direction + 2) % 4][1]);
+                arrow->signal = S_NONE;
+                break;
+            case SplitterUpRight:
+                if(arrow->signal != S_RED) {
+                    arrow->signal = S_NONE;
+                    break;
+                }
+                map_power(map, chunk, arrow_x+updates_straight[arrow->direction][0], arrow_y + updates_straight[arrow->direction][1]);
+                if (arrow->flipped) {
+                    map_power(map, chunk, arrow_x+updates_straight[(arrow->direction + 3) % 4][0], arrow_y + updates_straight[(arrow->direction + 3) % 4][1]);
+                } else {
+                    map_power(map, chunk, arrow_x+updates_straight[(arrow->direction + 1) % 4][0], arrow_y + updates_straight[(arrow->direction + 1) % 4][1]);
+                }
+                arrow->signal = S_NONE;
+                break;
+            case SplitterUpRightLeft:
+                if(arrow->signal != S_RED) {
+                    arrow->signal = S_NONE;
+                    break;
+                }
+                map_power(map, chunk, arrow_x+updates_straight[arrow->direction][0], arrow_y + updates_straight[arrow->direction][1]);
+                map_power(map, chunk, arrow_x+updates_straight[(arrow->direction + 1) % 4][0], arrow_y + updates_straight[(arrow->direction + 1) % 4][1]);
+                map_power(map, chunk, arrow_x+updates_straight[(arrow->direction + 3) % 4][0], arrow_y + updates_straight[(arrow->direction + 3) % 4][1]);
+                arrow->signal = S_NONE;
+                break;
+            case Pulse:
+                switch(arrow->signal) {
+                    case S_BLOCK:
+                    case S_DELAY_AFTER_RED: // Should be unreachable
+                    case S_NONE:
+                        arrow->signal = S_RED;
+                        break;
+                    case S_BLUE:
+                        break;
+                    case S_RED:
+                        map_power(map, chunk, arrow_x+1, arrow_y);
+                        map_power(map, chunk, arrow_x-1, arrow_y);
+                        map_power(map, chunk, arrow_x, arrow_y+1);
+                        map_power(map, chunk, arrow_x, arrow_y-1);
+                        arrow->signal = S_BLUE;
+                        break;
+                    case S_YELLOW:
+                    case S_ORANGE:
+                        break;
+                }
+                break;
+            case BlueArrow:
+                if(arrow->signal != S_BLUE) {
+                    arrow->signal = S_NONE;
+                    break;
+                }
+                map_power(map, chunk, arrow_x+updates_straight[arrow->direction][0]*2, arrow_y+updates_straight[arrow->direction][1]*2);
+                arrow->signal = S_NONE;
+                break;
+            case Diagonal:
+                if(arrow->signal != S_BLUE) {
+                    arrow->signal = S_NONE;
+                    break;
+                }
+                if(arrow->flipped) {
+                    map_power(map, chunk, arrow_x+updates_diagonal[(arrow->direction+3)%4][0], arrow_y + updates_diagonal[(arrow->direction+3)%4][1]);
+                } else {
+                    map_power(map, chunk, arrow_x+updates_diagonal[arrow->direction][0], arrow_y + updates_diagonal[arrow->direction][1]);
+                }
+                arrow->signal = S_NONE;
+                break;
+            case BlueSplitterUpUp:
+                if(arrow->signal != S_BLUE) {
+                    arrow->signal = S_NONE;
+                    break;
+                }
+                map_power(map, chunk, arrow_x+updates_straight[arrow->direction][0], arrow_y + updates_straight[arrow->direction][1]);
+                map_power(map, chunk, arrow_x+updates_straight[arrow->direction][0]*2, arrow_y + updates_straight[arrow->direction][1]*2);
+                arrow->signal = S_NONE;
+                break;
+            case BlueSplitterRightUp:
+                if(arrow->signal != S_BLUE) {
+                    arrow->signal = S_NONE;
+                    break;
+                }
+                map_power(map, chunk, arrow_x+updates_straight[(arrow->direction) % 4][0]*2, arrow_y + updates_straight[(arrow->direction) % 4][1]*2);
+                if (arrow->flipped) {
+                    map_power(map, chunk, arrow_x+updates_straight[(arrow->direction + 3) % 4][0], arrow_y + updates_straight[(arrow->direction + 3) % 4][1]);
+                } else {
+                    map_power(map, chunk, arrow_x+updates_straight[(arrow->direction + 1) % 4][0], arrow_y + updates_straight[(arrow->direction + 1) % 4][1]);
+                }
+                arrow->signal = S_NONE;
+                break;
+            case BlueSplitterUpDiagonal:
+                if(arrow->signal != S_BLUE) {
+                    arrow->signal = S_NONE;
+                    break;
+                }
+                map_power(map, chunk, arrow_x+updates_straight[arrow->direction][0], arrow_y + updates_straight[arrow->direction][1]);
+                if(arrow->flipped) {
+                    map_power(map, chunk, arrow_x+updates_diagonal[(arrow->direction+3)%4][0], arrow_y + updates_diagonal[(arrow->direction+3)%4][1]);
+                } else {
+                    map_power(map, chunk, arrow_x+updates_diagonal[arrow->direction][0], arrow_y + updates_diagonal[arrow->direction][1]);
+                }
+                arrow->signal = S_NONE;
+                break;
+            case Not:
+                if(arrow->signal != S_YELLOW) {
+                    arrow->signal = S_YELLOW;
+                    break;
+                }
+                map_power(map, chunk, arrow_x+updates_straight[arrow->direction][0], arrow_y+updates_straight[arrow->direction][1]);
+                break;
+            case And:
+            case Xor:
+                if(arrow->signal != S_YELLOW) {
+                    arrow->signal = S_NONE;
+                    break;
+                }
+                map_power(map, chunk, arrow_x+updates_straight[arrow->direction][0], arrow_y + updates_straight[arrow->direction][1]);
+                arrow->signal = S_NONE;
+                break;
+            case Latch:
+            case Flipflop:
+                if(arrow->signal != S_YELLOW) {
+                    arrow->signal = S_NONE;
+                    break;
+                }
+                map_power(map, chunk, arrow_x+updates_straight[arrow->direction][0], arrow_y + updates_straight[arrow->direction][1]);
+                break;
+            case Random:
+            case DirectoinalButton:
+            case Button:
+                if(arrow->signal != S_ORANGE) {
+                    arrow->signal = S_NONE;
+                    break;
+                }
+                map_power(map, chunk, arrow_x+updates_straight[arrow->direction][0], arrow_y + updates_straight[arrow->direction][1]);
+                arrow->signal = S_NONE;
+                break;
+
+            case LevelSource:
+                break;
+            case LevelTarget: break;
+        }
+        arrow->signal_count = 0;
+    }
+#if DEBUG
+    debug->events = arrlenu(chunk->update_queue);
+#endif // DEBUG
+}
+
+void map_update(map_t *map) {
+    map_apply_edits(map);
+    const size_t chunk_count = hmlen(map->chunks);
+    size_t active_chunks = 0;
+    for(size_t i = 0; i < chunk_count; i++) {
+        if (map->chunks[i].value->unload_timer < UNLOAD_TIMER_MAX) {
+            active_chunks++;
+            // signals of chunk change in this tick
+            map_mark_changed(map, map->chunks[i].key, map->chunks[i].value);
+        }
+    }
+    const int threads = map_choose_threads(map, active_chunks);
+    // work counters are per node so workers can take their
+    // own node's chunks first
+    const int lists = map->placement == PLACEMENT_LOCAL ? map->node_count : 1;
+    for (int n = 0; n < lists; n++) {
+        atomic_store_explicit(&map->nodes[n].next, 0, memory_order_relaxed);
+    }
+#if DEBUG
+    arrsetlen(map->debug, chunk_count);
+#endif // DEBUG
+    const double start = omp_get_wtime();
+#pragma omp parallel num_threads(threads) if(threads > 1) proc_bind(spread)
+    {
+        int home = lists > 1 ? map_thread_node(map) : 0;
+        for (int k = 0; k < lists; k++) {
+            numa_node_t *node = &map->nodes[(home + k) % lists];
+            const size_t count = arrlenu(node->chunks);
+            for (;;) {
+                size_t first = atomic_fetch_add_explicit(&node->next, CHUNK_BATCH, memory_order_relaxed);
+                if (first >= count) break;
+                size_t last = first + CHUNK_BATCH < count ? first + CHUNK_BATCH : count;
+                for (size_t i = first; i < last; i++) {
+                    chunk_update(map, &map->chunks[node->chunks[i]]);
+                }
+            }
+        }
+    }
+    if (active_chunks > 0) {
+        // total cpu time spent, assuming all threads were busy
+        double cost = (omp_get_wtime() - start) * threads / active_chunks;
+        if (map->stats.chunk_cost <= 0)
+            map->stats.chunk_cost = cost;
+        else
+            map->stats.chunk_cost += (cost - map->stats.chunk_cost) * CHUNK_COST_SMOOTHING;
+    }
+    map->stats.threads = threads;
+    map->stats.active_chunks = active_chunks;
+    map_queue_update(map);
+    map->pager.tick++;
+    map_evict(map);
+}
@@ -0,0 +1,375 @@
+#ifndef MAP_H
+#define MAP_H
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// must be power of two
+#define CHUNK_SIZE 16
+// newest map_import format version this build understands
+#define MAP_VERSION 0
+
+#ifndef DEBUG
+#define DEBUG 0
+#endif // DEBUG
+
+enum CellType {
+    Empty,
+    Arrow,
+    Source,
+    Blocker,
+    Delay,
+    Detector,
+    SplitterUpDown,
+    SplitterUpRight,
+    SplitterUpRightLeft,
+    Pulse,
+    BlueArrow,
+    Diagonal,
+    BlueSplitterUpUp,
+    BlueSplitterRightUp,
+    BlueSplitterUpDiagonal,
+    Not,
+    And,
+    Xor,
+    Latch,
+    Flipflop,
+    Random,
+    Button,
+    LevelSource,
+    LevelTarget,
+    DirectoinalButton,
+};
+#define MAX_CELL_TYPES (DirectoinalButton + 1)
+
+enum SignalType {
+    S_NONE,
+
+    // used by blocker
+    S_BLOCK,
+
+    S_RED,
+    S_BLUE,
+    S_YELLOW,
+    S_ORANGE,
+
+    // used by delay
+    S_DELAY_AFTER_RED,
+};
+
+enum Direction {
+    D_NORTH,
+    D_EAST,
+    D_SOUTH,
+    D_WEST,
+};
+
+typedef struct {
+    int32_t x;
+    int32_t y;
+} point_t;
+
+typedef struct {
+    enum CellType type;
+    uint8_t signal_count;
+
+    enum SignalType signal;
+    enum Direction direction;
+    bool flipped;
+} arrow_t;
+
+// used instead of second buffer
+// i'm thinking about switching to
+// second buffer but i'm not sure about it's efficency
+typedef struct {
+    enum QueueType {
+        QT_POWER, QT_BLOCK
+    } type;
+    point_t position;
+} queue_t;
+
+// bits of chunk_t.dirty, set when type, direction or flip
+// of any cell changes, every consumer owns one bit and only
+// clears its own
+enum ChunkDirty {
+    DIRTY_AUTOSAVE = 1 << 0,
+    // cached layout texture of the renderer
+    DIRTY_RENDER = 1 << 1,
+    // also set whenever signals may have changed, that is
+    // chunk was updated or got an event
+    DIRTY_SIGNALS = 1 << 2,
+    // level of detail images of the renderer, same as DIRTY_SIGNALS
+    DIRTY_LOD = 1 << 3,
+    // instance buffer of the renderer, same as DIRTY_SIGNALS
+    DIRTY_INSTANCES = 1 << 4,
+};
+// set by the engine when signals may have changed
+#define DIRTY_SIGNAL_BITS (DIRTY_SIGNALS | DIRTY_LOD | DIRTY_INSTANCES)
+
+// palette index of cell in chunk_signal_image
+enum SignalColor {
+    SIGNAL_COLOR_NONE,
+    SIGNAL_COLOR_RED,
+    SIGNAL_COLOR_BLUE,
+    SIGNAL_COLOR_YELLOW,
+    SIGNAL_COLOR_ORANGE,
+    SIGNAL_COLORS,
+};
+#define DIRTY_ALL 0xFF
+
+// chunk is updated while unload_timer is below this, every
+// event reaching it sets the timer back to 0
+#define UNLOAD_TIMER_MAX 5
+
+typedef struct {
+    arrow_t arrows[CHUNK_SIZE*CHUNK_SIZE];
+    queue_t *update_queue;
+    uint8_t unload_timer;
+    // numa node memory of this chunk belongs to
+    uint8_t node;
+    // ChunkDirty bits, new chunks have all of them set
+    uint8_t dirty;
+    // pager_t.tick of the last event or edit
+    uint32_t last_active;
+    // key is in map_t.changed
+    bool changed;
+} chunk_t;
+
+// compressed chunk layout is bitmap of occupied cells and
+// run-length coded cells, signals aren't stored, in the worst
+// case every cell is literal and needs one control byte per 128
+#define CHUNK_LAYOUT_MAX_SIZE (CHUNK_SIZE*CHUNK_SIZE/8 + CHUNK_SIZE*CHUNK_SIZE + CHUNK_SIZE*CHUNK_SIZE/128)
+
+typedef struct {
+    // decision made for the last tick
+    int threads;
+    size_t active_chunks;
+    // average time to update one chunk on one thread, in seconds
+    double chunk_cost;
+    // applied at the end of the last tick
+    size_t events;
+} map_stats_t;
+
+#if DEBUG
+// diagnostics of chunk from the last tick, written by the
+// worker which updated it and drawn by the ui afterwards
+typedef struct {
+    point_t key;
+    uint8_t unload_timer;
+    // produced by the chunk
+    uint32_t events;
+    // omp thread number, -1 if chunk wasn't updated
+    int thread;
+} chunk_debug_t;
+#endif // DEBUG
+
+// edits are queued by any thread and applied by the
+// simulation between ticks, so ui and tools never touch
+// chunks while map_update is working on them
+typedef struct {
+    enum EditType {
+        E_PLACE, E_REMOVE, E_ROTATE, E_FLIP, E_INTERACT
+    } type;
+    point_t position;
+    // used by E_PLACE
+    enum CellType cell;
+    // used by E_PLACE and E_ROTATE
+    enum Direction direction;
+    // used by E_PLACE
+    bool flipped;
+} edit_t;
+
+// must be power of two
+#define EDIT_QUEUE_SIZE 4096
+
+// bounded lock-free multi-producer single-consumer ring,
+// every slot has sequence number telling whether it's free
+// for producer at position `sequence` or ready for consumer
+// at position `sequence - 1`
+typedef struct {
+    struct EditSlot {
+        _Atomic size_t sequence;
+        edit_t edit;
+    } slots[EDIT_QUEUE_SIZE];
+    _Atomic size_t head;
+    // only touched by consumer
+    size_t tail;
+} edit_queue_t;
+
+#define MAX_NUMA_NODES 8
+
+typedef struct {
+    // indices into map_t.chunks updated by workers of this node
+    size_t *chunks;
+    // unused chunks in this node's memory
+    chunk_t **free;
+    // every allocation free chunks come from
+    chunk_t **slabs;
+    // next index in chunks to be taken during map_update
+    _Atomic size_t next;
+} numa_node_t;
+
+enum Placement {
+    // chunks live on one of the nodes and are updated by its workers
+    PLACEMENT_LOCAL,
+    // chunks are spread over nodes and updated by any worker
+    PLACEMENT_INTERLEAVED,
+};
+
+// part of the map simulated by one process, chunk columns
+// are split into bands of band_width chunks
+typedef struct {
+    int rank, count;
+    int32_t x_min, band_width;
+} partition_t;
+
+static inline int partition_owner(const partition_t *partition, int32_t chunk_x) {
+    int32_t band = (chunk_x - partition->x_min) / partition->band_width;
+    if (chunk_x < partition->x_min || band < 0) return 0;
+    if (band >= partition->count) return partition->count - 1;
+    return band;
+}
+
+typedef struct {
+    // slot in pager file, unused if size is 0
+    uint64_t offset;
+    // compressed layout if pager has no file
+    uint8_t *data;
+    // 0 if chunk has no cells
+    uint32_t size;
+    uint8_t dirty;
+    // part of map_checksum for this chunk
+    uint64_t checksum;
+} paged_chunk_t;
+
+// pager file is split into slots of multiples of this size,
+// freed slots are reused by chunks of the same size class
+#define PAGER_SLOT_SIZE 32
+#define PAGER_SLOT_CLASSES ((CHUNK_LAYOUT_MAX_SIZE + PAGER_SLOT_SIZE - 1) / PAGER_SLOT_SIZE + 1)
+
+// cold chunks (no signals, no events for a while) are evicted
+// once more than budget chunks are in memory, and faulted back
+// in when edit or event reaches them
+typedef struct {
+    // 0 if pager isn't used
+    size_t budget;
+    // compressed chunks are kept in memory if it's NULL
+    FILE *file;
+    // incremented by map_update, used to evict least recently active first
+    uint32_t tick;
+    // map_evict doesn't scan chunks before this tick
+    uint32_t next_scan;
+    struct PagedChunk { point_t key; paged_chunk_t value; } *chunks;
+    // slots of chunks that were faulted back in, by size class
+    uint64_t *free[PAGER_SLOT_CLASSES];
+    uint64_t file_size;
+    size_t evictions, faults;
+    // sum of paged_chunk_t.size
+    uint64_t bytes;
+} pager_t;
+
+typedef struct map_t {
+    uint16_t version;
+    struct HashTable { point_t key; chunk_t *value; } *chunks;
+    queue_t *update_queue;
+    edit_queue_t *edits;
+    // NULL if whole map is simulated by this process
+    const partition_t *partition;
+    // events for chunks owned by other processes
+    queue_t *outbox;
+    // used by Random cells
+    uint64_t random_state;
+    // upper bound for map_choose_threads
+    int max_threads;
+    // must be set before first chunk is created
+    enum Placement placement;
+    int node_count;
+    numa_node_t nodes[MAX_NUMA_NODES];
+    map_stats_t stats;
+    pager_t pager;
+    // when set, keys of chunks which got events, edits or were
+    // updated or added are collected in changed, every key
+    // once until map_clear_changed
+    bool track_changes;
+    point_t *changed;
+#if DEBUG
+    // entry of every chunk, in the same order as chunks
+    chunk_debug_t *debug;
+#endif // DEBUG
+} map_t;
+
+// takes x and y and returns hashmap key, division rounds
+// down, so chunk -1 has cells from -16 to -1
+static inline point_t pos2chunk(int x, int y) {
+    return (point_t){
+        .x = (x < 0 ? x - (CHUNK_SIZE - 1) : x) / CHUNK_SIZE,
+        .y = (y < 0 ? y - (CHUNK_SIZE - 1) : y) / CHUNK_SIZE,
+    };
+}
+
+// index of cell x, y in arrows of it's chunk
+static inline int pos2index(int x, int y) {
+    return (y & (CHUNK_SIZE - 1)) * CHUNK_SIZE + (x & (CHUNK_SIZE - 1));
+}
+
+enum ImportError {
+    IMPORT_OK,
+    IMPORT_INVALID_BASE64,
+    IMPORT_TRUNCATED,
+    IMPORT_UNSUPPORTED_VERSION,
+    IMPORT_INVALID_TYPE,
+    IMPORT_INVALID_CELL,
+};
+
+void map_init(map_t *map);
+// frees everything except memory of chunks loaded from snapshot
+void map_free(map_t *map);
+// evicts cold chunks once more than budget chunks are in memory,
+// to file at path or, if it's NULL, compressed into memory
+bool map_pager_open(map_t *map, const char *path, size_t budget);
+// fills chunk with layout of pager.chunks[i] without faulting it in
+void map_paged_read(map_t *map, size_t i, chunk_t *chunk);
+// returns encoded size, 0 if chunk has no cells
+size_t chunk_encode_layout(const chunk_t *chunk, uint8_t out[CHUNK_LAYOUT_MAX_SIZE]);
+// all signals are cleared, returns false if input is invalid
+bool chunk_decode_layout(const uint8_t *in, size_t size, chunk_t *chunk);
+// one SignalColor per cell, in the same order as arrows
+void chunk_signal_image(const chunk_t *chunk, uint8_t out[CHUNK_SIZE*CHUNK_SIZE]);
+// returned value is always not NULL
+chunk_t* map_get_chunk(map_t *map, int32_t x, int32_t y);
+// adds already allocated chunk, key must not be in the map yet
+void map_insert_chunk(map_t *map, point_t key, chunk_t *chunk);
+// returned value is always not NULL
+arrow_t* map_get(map_t *map, int32_t x, int32_t y);
+// returns NULL if chunk doesn't exist, never creates chunks
+arrow_t* map_find(map_t *map, int32_t x, int32_t y);
+// chunk can be NULL
+void map_power(map_t *map, chunk_t *chunk, int x, int y);
+// chunk can be NULL
+void map_block(map_t *map, chunk_t *chunk, int x, int y);
+// chunks read before an error stay in the map
+enum ImportError map_import(map_t *map, const char *input);
+// reads base64 from file in blocks, whitespace is ignored
+enum ImportError map_import_file(map_t *map, FILE *file);
+const char* import_error_string(enum ImportError error);
+// returns map in map_import format as stb_ds string (free with arrfree),
+// or NULL if there are more chunks or they are further than format allows
+char* map_export(map_t *map);
+// same as map_export, but streams output into file
+bool map_export_file(map_t *map, FILE *file);
+// applies events as if they were produced by this tick
+void map_apply_events(map_t *map, const queue_t *events, size_t count);
+// order independent hash of layout and signals
+uint64_t map_checksum(map_t *map);
+int map_choose_threads(map_t *map, size_t active_chunks);
+// safe to call from any thread, returns false if queue is full
+bool map_edit(map_t *map, edit_t edit);
+// must be called by the thread that runs map_update
+void map_apply_edits(map_t *map);
+void map_update(map_t *map);
+// must be called by the thread that runs map_update
+void map_clear_changed(map_t *map);
+
+#endif // MAP_H
@@ -0,0 +1,228 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <raylib.h>
+#include <omp.h>
+
+#include "stb_ds.h"
+#include "map.h"
+#include "load.h"
+#include "render.h"
+#include "atlas.h"
+#include "raster.h"
+
+// frames larger than this are refused
+#define RASTER_MAX_SIZE 16384
+// used when pixels per cell aren't given and frame isn't too large
+#define RASTER_DEFAULT_CELL 16
+// smaller cells are flat colors instead of sprites
+#define RASTER_SPRITE_MIN 4
+// tiles are rendered in parallel, every chunk is in one of them
+#define RASTER_TILE_CHUNKS 8
+// background of light and dark gui styles
+#define RASTER_LIGHT_BACKGROUND (Color){ 0xf5, 0xf5, 0xf5, 0xff }
+#define RASTER_DARK_BACKGROUND  (Color){ 0x3c, 0x3c, 0x3c, 0xff }
+
+typedef struct {
+    // pixels per cell
+    int cell;
+    // chunk in the top left corner
+    point_t origin;
+    int width, height;
+    Color *pixels;
+    Color background;
+    Color palette[SIGNAL_COLORS];
+    Color type_colors[MAX_CELL_TYPES];
+    // cell*cell pixels of every type in every orientation, that
+    // is direction plus 4 if flipped, NULL if cells are flat
+    Color *sprites[MAX_CELL_TYPES][8];
+} raster_t;
+
+// sprites are scaled, flipped and turned once, so
+// drawing a cell is only copying pixels
+static void raster_load_sprites(raster_t *raster, Image atlas) {
+    atlas_type_colors(atlas, raster->type_colors);
+    if (raster->cell < RASTER_SPRITE_MIN || atlas.data == NULL) return;
+    for (int type = Empty + 1; type < MAX_CELL_TYPES; type++) {
+        const Rectangle rect = {
+            .x = ((type-1) % ATLAS_COLUMNS) * ATLAS_SPRITE_SIZE,
+            .y = ((type-1) / ATLAS_COLUMNS) * ATLAS_SPRITE_SIZE,
+            .width = ATLAS_SPRITE_SIZE,
+            .height = ATLAS_SPRITE_SIZE,
+        };
+        if (rect.x + rect.width > atlas.width || rect.y + rect.height > atlas.height) continue;
+        Image sprite = ImageFromImage(atlas, rect);
+        ImageResize(&sprite, raster->cell, raster->cell);
+        for (int flipped = 0; flipped < 2; flipped++) {
+            // flipped first and then turned, as in the gui
+            Image turned = ImageCopy(sprite);
+            if (flipped) ImageFlipHorizontal(&turned);
+            for (int direction = D_NORTH; direction <= D_WEST; direction++) {
+                raster->sprites[type][direction + 4*flipped] = LoadImageColors(turned);
+                ImageRotateCW(&turned);
+            }
+            UnloadImage(turned);
+        }
+        UnloadImage(sprite);
+    }
+}
+
+static void raster_free(raster_t *raster) {
+    for (int type = 0; type < MAX_CELL_TYPES; type++) {
+        for (int i = 0; i < 8; i++) {
+            UnloadImageColors(raster->sprites[type][i]);
+        }
+    }
+    free(raster->pixels);
+}
+
+static inline Color blend(Color under, Color over) {
+    const int a = over.a;
+    return (Color){
+        (over.r*a + under.r*(0xff - a)) / 0xff,
+        (over.g*a + under.g*(0xff - a)) / 0xff,
+        (over.b*a + under.b*(0xff - a)) / 0xff,
+        0xff,
+    };
+}
+
+static void raster_chunk(raster_t *raster, point_t key, const chunk_t *chunk) {
+    uint8_t signals[CHUNK_SIZE*CHUNK_SIZE];
+    chunk_signal_image(chunk, signals);
+    const int cell = raster->cell;
+    const int left = (key.x - raster->origin.x)*CHUNK_SIZE*cell;
+    const int top = (key.y - raster->origin.y)*CHUNK_SIZE*cell;
+    for (size_t i = 0; i < CHUNK_SIZE*CHUNK_SIZE; i++) {
+        const arrow_t *arrow = &chunk->arrows[i];
+        if (arrow->type == Empty) continue;
+        const Color signal = raster->palette[signals[i]];
+        const Color *sprite = raster->sprites[arrow->type][arrow->direction + (arrow->flipped ? 4 : 0)];
+        for (int y = 0; y < cell; y++) {
+            Color *row = raster->pixels + (size_t)(top + (i / CHUNK_SIZE)*cell + y)*raster->width + left + (i % CHUNK_SIZE)*cell;
+            for (int x = 0; x < cell; x++) {
+                const Color under = signal.a != 0 ? signal : row[x];
+                if (sprite != NULL) row[x] = blend(under, sprite[y*cell + x]);
+                else row[x] = signal.a != 0 ? signal : raster->type_colors[arrow->type];
+            }
+        }
+    }
+}
+
+// chunks outside of the frame are skipped
+static void raster_frame(raster_t *raster, map_t *map) {
+    const int tile_pixels = RASTER_TILE_CHUNKS*CHUNK_SIZE*raster->cell;
+    const int tiles_x = (raster->width + tile_pixels - 1) / tile_pixels;
+    const int tiles_y = (raster->height + tile_pixels - 1) / tile_pixels;
+    const int chunks_x = raster->width / (CHUNK_SIZE*raster->cell);
+    const int chunks_y = raster->height / (CHUNK_SIZE*raster->cell);
+    // indices of chunks in every tile
+    size_t **tiles = calloc(tiles_x*tiles_y, sizeof(*tiles));
+    assert(tiles != NULL && "No RAM");
+    for (size_t i = 0; i < hmlenu(map->chunks); i++) {
+        const int x = map->chunks[i].key.x - raster->origin.x;
+        const int y = map->chunks[i].key.y - raster->origin.y;
+        if (x < 0 || y < 0 || x >= chunks_x || y >= chunks_y) continue;
+        arrput(tiles[(y / RASTER_TILE_CHUNKS)*tiles_x + x / RASTER_TILE_CHUNKS], i);
+    }
+#pragma omp parallel for schedule(dynamic)
+    for (int t = 0; t < tiles_x*tiles_y; t++) {
+        const int left = (t % tiles_x)*tile_pixels, top = (t / tiles_x)*tile_pixels;
+        const int right = left + tile_pixels < raster->width ? left + tile_pixels : raster->width;
+        const int bottom = top + tile_pixels < raster->height ? top + tile_pixels : raster->height;
+        for (int y = top; y < bottom; y++) {
+            for (int x = left; x < right; x++) {
+                raster->pixels[(size_t)y*raster->width + x] = raster->background;
+            }
+        }
+        for (size_t i = 0; i < arrlenu(tiles[t]); i++) {
+            raster_chunk(raster, map->chunks[tiles[t][i]].key, map->chunks[tiles[t][i]].value);
+        }
+        arrfree(tiles[t]);
+    }
+    free(tiles);
+}
+
+int raster_run(int argc, char **argv) {
+    const char *path = argc > 0 ? argv[0] : "maps/default.txt";
+    const char *prefix = argc > 1 ? argv[1] : "frame-";
+    int first = argc > 2 ? atoi(argv[2]) : 0;
+    int last = argc > 3 ? atoi(argv[3]) : first;
+    int cell = argc > 4 ? atoi(argv[4]) : 0;
+    bool dark = argc > 5 && atoi(argv[5]) != 0;
+    if (first < 0 || last < first || cell < 0) {
+        fprintf(stderr, "raster: invalid tick range or cell size\n");
+        return 1;
+    }
+
+    map_t map = { 0 };
+    map_init(&map);
+    if (!load_map(&map, path)) return 1;
+    if (hmlenu(map.chunks) == 0) {
+        fprintf(stderr, "raster: %s is empty\n", path);
+        map_free(&map);
+        return 1;
+    }
+    // frame covers chunks of the first tick
+    point_t min = map.chunks[0].key, max = map.chunks[0].key;
+    for (size_t i = 1; i < hmlenu(map.chunks); i++) {
+        const point_t key = map.chunks[i].key;
+        if (key.x < min.x) min.x = key.x;
+        if (key.y < min.y) min.y = key.y;
+        if (key.x > max.x) max.x = key.x;
+        if (key.y > max.y) max.y = key.y;
+    }
+    const int64_t cells_x = (int64_t)(max.x - min.x + 1)*CHUNK_SIZE;
+    const int64_t cells_y = (int64_t)(max.y - min.y + 1)*CHUNK_SIZE;
+    if (cell == 0) {
+        cell = RASTER_DEFAULT_CELL;
+        while (cell > 1 && (cells_x*cell > RASTER_MAX_SIZE || cells_y*cell > RASTER_MAX_SIZE)) cell--;
+    }
+    if (cells_x*cell > RASTER_MAX_SIZE || cells_y*cell > RASTER_MAX_SIZE) {
+        fprintf(stderr, "raster: frame of %lldx%lld cells is too large\n", (long long)cells_x, (long long)cells_y);
+        map_free(&map);
+        return 1;
+    }
+
+    raster_t raster = {
+        .cell = cell,
+        .origin = min,
+        .width = cells_x*cell,
+        .height = cells_y*cell,
+        .background = dark ? RASTER_DARK_BACKGROUND : RASTER_LIGHT_BACKGROUND,
+    };
+    raster.pixels = malloc((size_t)raster.width*raster.height*sizeof(Color));
+    assert(raster.pixels != NULL && "No RAM");
+    for (int i = 0; i < SIGNAL_COLORS; i++) {
+        raster.palette[i] = signal_color(i, dark);
+    }
+    SetTraceLogLevel(LOG_WARNING);
+    raster_load_sprites(&raster, atlas_image(dark));
+
+    const Image frame = {
+        .data = raster.pixels,
+        .width = raster.width,
+        .height = raster.height,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+    };
+    double render_time = 0;
+    bool ok = true;
+    for (int tick = 0; tick <= last && ok; tick++) {
+        if (tick >= first) {
+            const double start = omp_get_wtime();
+            raster_frame(&raster, &map);
+            render_time += omp_get_wtime() - start;
+            char name[4096];
+            snprintf(name, sizeof(name), "%s%06d.png", prefix, tick);
+            ok = ExportImage(frame, name);
+            if (!ok) fprintf(stderr, "raster: can't write %s\n", name);
+        }
+        if (tick < last) map_update(&map);
+    }
+    printf("%d frames of %dx%d pixels, %d per cell, %.2fms per frame\n",
+            last - first + 1, raster.width, raster.height, cell, render_time * 1e3 / (last - first + 1));
+
+    raster_free(&raster);
+    map_free(&map);
+    return ok ? 0 : 1;
+}
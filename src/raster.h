@@ -0,0 +1,8 @@
+#ifndef RASTER_H
+#define RASTER_H
+
+// renders map into png frames on cpu, doesn't open a window
+// usage: --raster [map] [output prefix] [first tick] [last tick] [pixels per cell, 0 picks one] [dark]
+int raster_run(int argc, char **argv);
+
+#endif // RASTER_H
@@ -0,0 +1,903 @@
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <raylib.h>
+#include <rlgl.h>
+
+#include "stb_ds.h"
+#include "map.h"
+#include "settings.h"
+#include "render.h"
+
+#define DARK_RED    (Color){0x99, 0x00, 0x00, 0xff}
+#define DARK_BLUE   (Color){0x00, 0x00, 0x66, 0xff}
+#define DARK_ORANGE (Color){0x99, 0x4C, 0x00, 0xff}
+#define DARK_YELLOW (Color){0x99, 0x66, 0x00, 0xff}
+
+#define LAYOUT_PIXELS (CHUNK_SIZE*LAYOUT_CELL_PIXELS)
+// called for chunks found by visit_chunks
+typedef void (*chunk_visitor_t)(renderer_t *renderer, point_t key, chunk_t *chunk, void *context);
+
+typedef struct {
+    Texture atlas;
+    int bakes;
+} sprite_context_t;
+
+#define INSTANCE_CELLS (INSTANCE_CHUNKS_MAX*CHUNK_SIZE*CHUNK_SIZE)
+
+// corner of quad, cell of instance and it's signal color
+static const char *instance_vertex_shader =
+    "#version 330\n"
+    "layout(location = 0) in vec2 vertexCorner;\n"
+    "layout(location = 1) in vec4 instanceCell;\n"
+    "layout(location = 2) in vec4 instanceColor;\n"
+    "uniform vec2 camera;\n"
+    "uniform float zoom;\n"
+    "uniform vec2 screen;\n"
+    // size of one sprite in texture coordinates
+    "uniform vec2 sprite;\n"
+    "out vec2 fragTexCoord;\n"
+    "out vec4 fragSignal;\n"
+    "void main() {\n"
+    "    fragSignal = instanceColor;\n"
+    "    if (instanceCell.z < 0.0) {\n"
+    "        gl_Position = vec4(2.0, 2.0, 2.0, 1.0);\n"
+    "        return;\n"
+    "    }\n"
+    // sprite is flipped and then turned clockwise, so
+    // corner is turned back and then flipped
+    "    vec2 p = vertexCorner - 0.5;\n"
+    "    int orientation = int(instanceCell.w);\n"
+    "    for (int i = 0; i < orientation % 4; i++) p = vec2(p.y, -p.x);\n"
+    "    if (orientation >= 4) p.x = -p.x;\n"
+    "    int index = int(instanceCell.z);\n"
+    "    fragTexCoord = (vec2(index % 8, index / 8) + p + 0.5) * sprite;\n"
+    "    vec2 position = (instanceCell.xy + vertexCorner - 0.5 - camera) * zoom;\n"
+    "    gl_Position = vec4(position.x / screen.x * 2.0 - 1.0, 1.0 - position.y / screen.y * 2.0, 0.0, 1.0);\n"
+    "}\n";
+
+// sprite is drawn over the signal
+static const char *instance_fragment_shader =
+    "#version 330\n"
+    "in vec2 fragTexCoord;\n"
+    "in vec4 fragSignal;\n"
+    "uniform sampler2D texture0;\n"
+    "out vec4 finalColor;\n"
+    "void main() {\n"
+    "    vec4 sprite = texture(texture0, fragTexCoord);\n"
+    "    float alpha = sprite.a + fragSignal.a * (1.0 - sprite.a);\n"
+    "    if (alpha <= 0.0) discard;\n"
+    "    vec3 color = sprite.rgb * sprite.a + fragSignal.rgb * fragSignal.a * (1.0 - sprite.a);\n"
+    "    finalColor = vec4(color / alpha, alpha);\n"
+    "}\n";
+
+static void instancer_init(instancer_t *instancer) {
+    *instancer = (instancer_t){ 0 };
+    Shader shader = LoadShaderFromMemory(instance_vertex_shader, instance_fragment_shader);
+    // raylib falls back to the default shader on errors
+    if (shader.id == 0 || shader.id == rlGetShaderIdDefault()) return;
+    instancer->shader = shader;
+    instancer->camera_location = GetShaderLocation(shader, "camera");
+    instancer->zoom_location = GetShaderLocation(shader, "zoom");
+    instancer->screen_location = GetShaderLocation(shader, "screen");
+    instancer->sprite_location = GetShaderLocation(shader, "sprite");
+
+    instancer->cell_data = malloc(INSTANCE_CELLS * sizeof(*instancer->cell_data));
+    instancer->color_data = calloc(INSTANCE_CELLS, sizeof(*instancer->color_data));
+    assert(instancer->cell_data != NULL && instancer->color_data != NULL && "No RAM");
+    for (size_t i = 0; i < INSTANCE_CELLS; i++) {
+        instancer->cell_data[i] = (instance_t){ .sprite = -1 };
+    }
+    // lowest slots are taken first, so fewer instances are drawn
+    for (size_t i = INSTANCE_CHUNKS_MAX; i > 0; i--) {
+        arrput(instancer->free_slots, i - 1);
+    }
+
+    // two triangles
+    static const float corners[] = { 0, 0, 0, 1, 1, 1, 0, 0, 1, 1, 1, 0 };
+    // every attribute has it's own buffer, so no offsets are needed
+    instancer->vao = rlLoadVertexArray();
+    rlEnableVertexArray(instancer->vao);
+    instancer->corners = rlLoadVertexBuffer(corners, sizeof(corners), false);
+    rlSetVertexAttribute(0, 2, RL_FLOAT, false, 0, 0);
+    rlEnableVertexAttribute(0);
+    instancer->cells = rlLoadVertexBuffer(instancer->cell_data, INSTANCE_CELLS * sizeof(*instancer->cell_data), true);
+    rlSetVertexAttribute(1, 4, RL_FLOAT, false, 0, 0);
+    rlSetVertexAttributeDivisor(1, 1);
+    rlEnableVertexAttribute(1);
+    instancer->colors = rlLoadVertexBuffer(instancer->color_data, INSTANCE_CELLS * sizeof(*instancer->color_data), true);
+    rlSetVertexAttribute(2, 4, RL_UNSIGNED_BYTE, true, 0, 0);
+    rlSetVertexAttributeDivisor(2, 1);
+    rlEnableVertexAttribute(2);
+    rlDisableVertexArray();
+}
+
+static void instancer_free(instancer_t *instancer) {
+    if (instancer->shader.id != 0) {
+        rlUnloadVertexArray(instancer->vao);
+        rlUnloadVertexBuffer(instancer->corners);
+        rlUnloadVertexBuffer(instancer->cells);
+        rlUnloadVertexBuffer(instancer->colors);
+        UnloadShader(instancer->shader);
+    }
+    hmfree(instancer->slots);
+    arrfree(instancer->free_slots);
+    free(instancer->cell_data);
+    free(instancer->color_data);
+    *instancer = (instancer_t){ 0 };
+}
+
+void render_init(renderer_t *renderer) {
+    *renderer = (renderer_t){ 0 };
+    instancer_init(&renderer->instancer);
+}
+
+static void render_clear_cache(renderer_t *renderer) {
+    for (size_t i = 0; i < hmlenu(renderer->chunks); i++) {
+        UnloadTexture(renderer->chunks[i].value.signals);
+        if (renderer->chunks[i].value.baked) UnloadRenderTexture(renderer->chunks[i].value.layout);
+    }
+    hmfree(renderer->chunks);
+}
+
+static void render_clear_regions(renderer_t *renderer) {
+    for (size_t i = 0; i < hmlenu(renderer->regions); i++) {
+        UnloadTexture(renderer->regions[i].value.texture);
+        UnloadImageColors(renderer->regions[i].value.pixels);
+    }
+    hmfree(renderer->regions);
+}
+
+static void minimap_free(minimap_t *minimap) {
+    if (minimap->texture.id != 0) UnloadTexture(minimap->texture);
+    free(minimap->last_event);
+    free(minimap->cells);
+    free(minimap->pixels);
+    *minimap = (minimap_t){ .first_row = 1 };
+}
+
+void render_free(renderer_t *renderer) {
+    render_clear_cache(renderer);
+    render_clear_regions(renderer);
+    instancer_free(&renderer->instancer);
+    minimap_free(&renderer->minimap);
+    *renderer = (renderer_t){ 0 };
+}
+
+chunk_range_t visible_chunks(void) {
+    // cell x is drawn centered at (x - camera.x)*zoom,
+    // so half of cell on each side of screen is visible too
+    const float left = settings.camera.x - 0.5f;
+    const float top = settings.camera.y - 0.5f;
+    const float right = settings.camera.x + GetScreenWidth()/settings.zoom + 0.5f;
+    const float bottom = settings.camera.y + GetScreenHeight()/settings.zoom + 0.5f;
+    return (chunk_range_t){
+        .min = pos2chunk(floorf(left), floorf(top)),
+        .max = pos2chunk(ceilf(right), ceilf(bottom)),
+    };
+}
+
+Color signal_color(enum SignalColor color, bool dark) {
+    switch (color) {
+    case SIGNAL_COLOR_RED:
+        return dark ? DARK_RED : RED;
+    case SIGNAL_COLOR_BLUE:
+        return dark ? DARK_BLUE : BLUE;
+    case SIGNAL_COLOR_ORANGE:
+        return dark ? DARK_ORANGE : ORANGE;
+    case SIGNAL_COLOR_YELLOW:
+        return dark ? DARK_YELLOW : YELLOW;
+    default:
+        return (Color){ 0, 0, 0, 0 };
+    }
+}
+
+// pixels of chunk_signal_image in palette of current theme
+static void signal_pixels(const chunk_t *chunk, Color pixels[CHUNK_SIZE*CHUNK_SIZE]) {
+    Color palette[SIGNAL_COLORS];
+    for (int i = 0; i < SIGNAL_COLORS; i++) {
+        palette[i] = signal_color(i, settings.dark_theme);
+    }
+    uint8_t image[CHUNK_SIZE*CHUNK_SIZE];
+    chunk_signal_image(chunk, image);
+    for (size_t i = 0; i < CHUNK_SIZE*CHUNK_SIZE; i++) {
+        pixels[i] = palette[image[i]];
+    }
+}
+
+static float direction_angle(enum Direction direction) {
+    switch (direction) {
+    case D_EAST:
+        return 90;
+    case D_SOUTH:
+        return 180;
+    case D_WEST:
+        return 270;
+    default:
+        return 0;
+    }
+}
+
+// top left corner of chunk on the screen
+static Vector2 chunk_origin(point_t key) {
+    return (Vector2){
+        .x = (key.x*CHUNK_SIZE - settings.camera.x)*settings.zoom - settings.zoom/2,
+        .y = (key.y*CHUNK_SIZE - settings.camera.y)*settings.zoom - settings.zoom/2,
+    };
+}
+
+static void draw_signals(const chunk_t *chunk, Vector2 origin, float size) {
+    Color pixels[CHUNK_SIZE*CHUNK_SIZE];
+    signal_pixels(chunk, pixels);
+    for(size_t j = 0; j < CHUNK_SIZE*CHUNK_SIZE; j++) {
+        if (pixels[j].a == 0) continue;
+        const Vector2 position = {
+            origin.x + (j % CHUNK_SIZE)*size,
+            origin.y + (j / CHUNK_SIZE)*size,
+        };
+        DrawRectangleV(position, (Vector2){ size, size }, pixels[j]);
+    }
+}
+
+// sprites of every cell, size is size of one cell
+static void draw_cells(const chunk_t *chunk, Vector2 origin, float size, Texture atlas) {
+    for(size_t j = 0; j < CHUNK_SIZE*CHUNK_SIZE; j++) {
+        const arrow_t *arrow = &chunk->arrows[j];
+        if(arrow->type == Empty) continue;
+        // rotated around the center of cell
+        Rectangle dest_rect = (Rectangle) {
+            .width = size,
+            .height = size,
+            .x = origin.x + (j % CHUNK_SIZE)*size + size/2,
+            .y = origin.y + (j / CHUNK_SIZE)*size + size/2,
+        };
+        Rectangle source_rect = (Rectangle) {
+            .x = ((arrow->type-1) % ATLAS_COLUMNS) * ATLAS_SPRITE_SIZE,
+            .y = ((arrow->type-1) / ATLAS_COLUMNS) * ATLAS_SPRITE_SIZE,
+            .width = arrow->flipped ? -ATLAS_SPRITE_SIZE : ATLAS_SPRITE_SIZE,
+            .height = ATLAS_SPRITE_SIZE,
+        };
+        DrawTexturePro(atlas, source_rect, dest_rect, (Vector2){ size/2, size/2 }, direction_angle(arrow->direction), WHITE);
+    }
+}
+
+static void upload_signals(chunk_cache_t *cache, const chunk_t *chunk) {
+    Color pixels[CHUNK_SIZE*CHUNK_SIZE];
+    signal_pixels(chunk, pixels);
+    UpdateTexture(cache->signals, pixels);
+}
+
+static size_t render_cache_limit(const renderer_t *renderer) {
+    const chunk_range_t range = renderer->range;
+    const size_t visible = ((size_t)range.max.x - range.min.x + 1) * ((size_t)range.max.y - range.min.y + 1);
+    return visible < CHUNK_CACHE_MAX - CHUNK_CACHE_MARGIN ? visible + CHUNK_CACHE_MARGIN : CHUNK_CACHE_MAX;
+}
+
+// returns NULL if cache is full, signals are up to date
+static chunk_cache_t* render_cache(renderer_t *renderer, point_t key, chunk_t *chunk) {
+    struct ChunkCache *entry = hmgetp_null(renderer->chunks, key);
+    if (entry == NULL) {
+        // trimmed at the end of frame
+        if (hmlenu(renderer->chunks) >= render_cache_limit(renderer)) return NULL;
+        Image image = GenImageColor(CHUNK_SIZE, CHUNK_SIZE, BLANK);
+        chunk_cache_t cache = { .signals = LoadTextureFromImage(image) };
+        UnloadImage(image);
+        hmput(renderer->chunks, key, cache);
+        entry = hmgetp(renderer->chunks, key);
+        chunk->dirty |= DIRTY_SIGNALS | DIRTY_RENDER;
+    }
+    if (chunk->dirty & DIRTY_SIGNALS) {
+        upload_signals(&entry->value, chunk);
+        chunk->dirty &= ~DIRTY_SIGNALS;
+    }
+    entry->value.last_used = renderer->frame;
+    return &entry->value;
+}
+
+// returns false if layout has to be drawn cell by cell this frame
+static bool render_bake(chunk_cache_t *cache, chunk_t *chunk, Texture atlas, int *bakes) {
+    if (cache->baked && !(chunk->dirty & DIRTY_RENDER)) return true;
+    if (*bakes >= LAYOUT_BAKES_PER_FRAME) return false;
+    if (!cache->baked) {
+        cache->layout = LoadRenderTexture(LAYOUT_PIXELS, LAYOUT_PIXELS);
+        SetTextureFilter(cache->layout.texture, TEXTURE_FILTER_BILINEAR);
+        cache->baked = true;
+    }
+    BeginTextureMode(cache->layout);
+    ClearBackground(BLANK);
+    draw_cells(chunk, (Vector2){ 0, 0 }, LAYOUT_CELL_PIXELS, atlas);
+    EndTextureMode();
+    chunk->dirty &= ~DIRTY_RENDER;
+    (*bakes)++;
+    return true;
+}
+
+static void draw_chunk(renderer_t *renderer, point_t key, chunk_t *chunk, void *context) {
+    sprite_context_t *sprites = context;
+    const Vector2 origin = chunk_origin(key);
+    chunk_cache_t *cache = render_cache(renderer, key, chunk);
+    if (cache == NULL) {
+        draw_signals(chunk, origin, settings.zoom);
+        draw_cells(chunk, origin, settings.zoom, sprites->atlas);
+        return;
+    }
+    const Rectangle dest = { origin.x, origin.y, CHUNK_SIZE*settings.zoom, CHUNK_SIZE*settings.zoom };
+    DrawTexturePro(cache->signals, (Rectangle){ 0, 0, CHUNK_SIZE, CHUNK_SIZE }, dest, (Vector2){ 0, 0 }, 0, WHITE);
+    if (!render_bake(cache, chunk, sprites->atlas, &sprites->bakes)) {
+        draw_cells(chunk, origin, settings.zoom, sprites->atlas);
+        return;
+    }
+    // render textures are stored upside down
+    const Rectangle source = { 0, 0, LAYOUT_PIXELS, -LAYOUT_PIXELS };
+    DrawTexturePro(cache->layout.texture, source, dest, (Vector2){ 0, 0 }, 0, WHITE);
+}
+
+static int compare_last_used(const void *a, const void *b) {
+    const uint64_t x = ((const struct ChunkCache*)a)->value.last_used;
+    const uint64_t y = ((const struct ChunkCache*)b)->value.last_used;
+    return (x > y) - (x < y);
+}
+
+// frees least recently drawn chunks, so next frame has room
+// for new ones, chunks drawn this frame are kept
+static void render_trim_cache(renderer_t *renderer) {
+    const size_t limit = render_cache_limit(renderer) - LAYOUT_BAKES_PER_FRAME;
+    if (hmlenu(renderer->chunks) <= limit) return;
+    struct ChunkCache *old = NULL;
+    for (size_t i = 0; i < hmlenu(renderer->chunks); i++) {
+        if (renderer->chunks[i].value.last_used != renderer->frame) arrput(old, renderer->chunks[i]);
+    }
+    if (old == NULL) return;
+    qsort(old, arrlenu(old), sizeof(*old), compare_last_used);
+    for (size_t i = 0; i < arrlenu(old) && hmlenu(renderer->chunks) > limit; i++) {
+        UnloadTexture(old[i].value.signals);
+        if (old[i].value.baked) UnloadRenderTexture(old[i].value.layout);
+        (void)hmdel(renderer->chunks, old[i].key);
+    }
+    arrfree(old);
+}
+
+static bool range_contains(chunk_range_t range, point_t key) {
+    return key.x >= range.min.x && key.x <= range.max.x &&
+        key.y >= range.min.y && key.y <= range.max.y;
+}
+
+static void visit_chunks(renderer_t *renderer, map_t *map, chunk_range_t range, chunk_visitor_t visit, void *context) {
+    const uint64_t area = (uint64_t)(range.max.x - range.min.x + 1) * (range.max.y - range.min.y + 1);
+    // zoomed far out screen can cover more chunk keys than
+    // the map has, then walking the map is cheaper
+    if (area > hmlenu(map->chunks)) {
+        for(size_t i = 0; i < hmlenu(map->chunks); i++) {
+            if (!range_contains(range, map->chunks[i].key)) continue;
+            visit(renderer, map->chunks[i].key, map->chunks[i].value, context);
+        }
+        return;
+    }
+    for (int32_t y = range.min.y; y <= range.max.y; y++) {
+        for (int32_t x = range.min.x; x <= range.max.x; x++) {
+            const point_t key = { x, y };
+            struct HashTable *entry = hmgetp_null(map->chunks, key);
+            if (entry != NULL) visit(renderer, key, entry->value, context);
+        }
+    }
+}
+
+void atlas_type_colors(Image atlas, Color colors[MAX_CELL_TYPES]) {
+    Color *pixels = atlas.data != NULL ? LoadImageColors(atlas) : NULL;
+    colors[Empty] = BLANK;
+    for (int type = Empty + 1; type < MAX_CELL_TYPES; type++) {
+        const int left = ((type-1) % ATLAS_COLUMNS) * ATLAS_SPRITE_SIZE;
+        const int top = ((type-1) / ATLAS_COLUMNS) * ATLAS_SPRITE_SIZE;
+        colors[type] = GRAY;
+        if (pixels == NULL || left + ATLAS_SPRITE_SIZE > atlas.width || top + ATLAS_SPRITE_SIZE > atlas.height) continue;
+        uint64_t r = 0, g = 0, b = 0, alpha = 0;
+        for (int y = top; y < top + ATLAS_SPRITE_SIZE; y++) {
+            for (int x = left; x < left + ATLAS_SPRITE_SIZE; x++) {
+                const Color color = pixels[y*atlas.width + x];
+                r += color.r * color.a;
+                g += color.g * color.a;
+                b += color.b * color.a;
+                alpha += color.a;
+            }
+        }
+        if (alpha == 0) continue;
+        colors[type] = (Color){ r/alpha, g/alpha, b/alpha, 0xff };
+    }
+    UnloadImageColors(pixels);
+}
+
+static void render_type_colors(renderer_t *renderer, Texture atlas) {
+    Image image = LoadImageFromTexture(atlas);
+    atlas_type_colors(image, renderer->type_colors);
+    UnloadImage(image);
+}
+
+// division rounding down like pos2chunk
+static int32_t floor_div(int32_t a, int32_t b) {
+    return (a < 0 ? a - (b - 1) : a) / b;
+}
+
+// chunks per side of region
+static int32_t region_chunks(enum LodTier tier) {
+    return tier == LOD_CELLS ? LOD_REGION_PIXELS / CHUNK_SIZE : LOD_REGION_PIXELS;
+}
+
+static point_t chunk_region(enum LodTier tier, point_t key) {
+    return (point_t){
+        .x = floor_div(key.x, region_chunks(tier)),
+        .y = floor_div(key.y, region_chunks(tier)),
+    };
+}
+
+// one pixel per cell, sprite becomes it's average color
+static void lod_cell_pixels(const renderer_t *renderer, const chunk_t *chunk, Color pixels[CHUNK_SIZE*CHUNK_SIZE]) {
+    signal_pixels(chunk, pixels);
+    for (size_t i = 0; i < CHUNK_SIZE*CHUNK_SIZE; i++) {
+        const enum CellType type = chunk->arrows[i].type;
+        if (type != Empty && pixels[i].a == 0) pixels[i] = renderer->type_colors[type];
+    }
+}
+
+// average of cell pixels, empty cells are transparent
+static Color lod_chunk_pixel(const Color pixels[CHUNK_SIZE*CHUNK_SIZE]) {
+    uint32_t r = 0, g = 0, b = 0, count = 0;
+    for (size_t i = 0; i < CHUNK_SIZE*CHUNK_SIZE; i++) {
+        if (pixels[i].a == 0) continue;
+        r += pixels[i].r;
+        g += pixels[i].g;
+        b += pixels[i].b;
+        count++;
+    }
+    if (count == 0) return BLANK;
+    return (Color){ r/count, g/count, b/count, 0xff*count/(CHUNK_SIZE*CHUNK_SIZE) };
+}
+
+static void lod_update_chunk(renderer_t *renderer, struct LodRegion *region, point_t key, chunk_t *chunk) {
+    Color pixels[CHUNK_SIZE*CHUNK_SIZE];
+    lod_cell_pixels(renderer, chunk, pixels);
+    const int32_t size = region_chunks(renderer->tier);
+    const int x = key.x - region->key.x*size;
+    const int y = key.y - region->key.y*size;
+    if (renderer->tier == LOD_CELLS) {
+        const Rectangle rect = { x*CHUNK_SIZE, y*CHUNK_SIZE, CHUNK_SIZE, CHUNK_SIZE };
+        UpdateTextureRec(region->value.texture, rect, pixels);
+    } else {
+        region->value.pixels[y*LOD_REGION_PIXELS + x] = lod_chunk_pixel(pixels);
+        region->value.stale = true;
+    }
+    chunk->dirty &= ~DIRTY_LOD;
+}
+
+static void lod_fill(renderer_t *renderer, point_t key, chunk_t *chunk, void *context) {
+    lod_update_chunk(renderer, context, key, chunk);
+}
+
+// new region is filled with every chunk it covers
+static void lod_create_region(renderer_t *renderer, map_t *map, point_t key) {
+    Image image = GenImageColor(LOD_REGION_PIXELS, LOD_REGION_PIXELS, BLANK);
+    lod_region_t region = { .texture = LoadTextureFromImage(image) };
+    SetTextureFilter(region.texture, TEXTURE_FILTER_BILINEAR);
+    if (renderer->tier == LOD_CHUNKS) region.pixels = LoadImageColors(image);
+    UnloadImage(image);
+    hmput(renderer->regions, key, region);
+    struct LodRegion *entry = hmgetp(renderer->regions, key);
+    const int32_t size = region_chunks(renderer->tier);
+    const chunk_range_t range = {
+        .min = { key.x*size, key.y*size },
+        .max = { key.x*size + size - 1, key.y*size + size - 1 },
+    };
+    visit_chunks(renderer, map, range, lod_fill, entry);
+}
+
+static void lod_visit(renderer_t *renderer, point_t key, chunk_t *chunk, void *context) {
+    const point_t region_key = chunk_region(renderer->tier, key);
+    struct LodRegion *region = hmgetp_null(renderer->regions, region_key);
+    if (region == NULL) lod_create_region(renderer, context, region_key);
+    else if (chunk->dirty & DIRTY_LOD) lod_update_chunk(renderer, region, key, chunk);
+}
+
+static void draw_regions(renderer_t *renderer, chunk_range_t range) {
+    const int32_t size = region_chunks(renderer->tier);
+    const float pixel = renderer->tier == LOD_CELLS ? settings.zoom : CHUNK_SIZE*settings.zoom;
+    const chunk_range_t regions = {
+        .min = chunk_region(renderer->tier, range.min),
+        .max = chunk_region(renderer->tier, range.max),
+    };
+    for (size_t i = 0; i < hmlenu(renderer->regions); i++) {
+        struct LodRegion *region = &renderer->regions[i];
+        if (!range_contains(regions, region->key)) continue;
+        if (region->value.stale) {
+            UpdateTexture(region->value.texture, region->value.pixels);
+            region->value.stale = false;
+        }
+        const Vector2 origin = chunk_origin((point_t){ region->key.x*size, region->key.y*size });
+        const Rectangle source = { 0, 0, LOD_REGION_PIXELS, LOD_REGION_PIXELS };
+        const Rectangle dest = { origin.x, origin.y, LOD_REGION_PIXELS*pixel, LOD_REGION_PIXELS*pixel };
+        DrawTexturePro(region->value.texture, source, dest, (Vector2){ 0, 0 }, 0, WHITE);
+        region->value.last_used = renderer->frame;
+    }
+}
+
+static int compare_region_used(const void *a, const void *b) {
+    const uint64_t x = ((const struct LodRegion*)a)->value.last_used;
+    const uint64_t y = ((const struct LodRegion*)b)->value.last_used;
+    return (x > y) - (x < y);
+}
+
+static void render_trim_regions(renderer_t *renderer) {
+    if (hmlenu(renderer->regions) <= LOD_REGION_MAX) return;
+    struct LodRegion *old = NULL;
+    for (size_t i = 0; i < hmlenu(renderer->regions); i++) {
+        if (renderer->regions[i].value.last_used != renderer->frame) arrput(old, renderer->regions[i]);
+    }
+    if (old == NULL) return;
+    qsort(old, arrlenu(old), sizeof(*old), compare_region_used);
+    for (size_t i = 0; i < arrlenu(old) && hmlenu(renderer->regions) > LOD_REGION_MAX; i++) {
+        UnloadTexture(old[i].value.texture);
+        UnloadImageColors(old[i].value.pixels);
+        (void)hmdel(renderer->regions, old[i].key);
+    }
+    arrfree(old);
+}
+
+// instances of cells of chunk, colored by current theme
+static void chunk_instances(point_t key, const chunk_t *chunk, instance_t cells[CHUNK_SIZE*CHUNK_SIZE], Color colors[CHUNK_SIZE*CHUNK_SIZE]) {
+    signal_pixels(chunk, colors);
+    for (size_t i = 0; i < CHUNK_SIZE*CHUNK_SIZE; i++) {
+        const arrow_t *arrow = &chunk->arrows[i];
+        if (arrow->type == Empty) {
+            cells[i] = (instance_t){ .sprite = -1 };
+            continue;
+        }
+        cells[i] = (instance_t){
+            .x = key.x*CHUNK_SIZE + i % CHUNK_SIZE,
+            .y = key.y*CHUNK_SIZE + i / CHUNK_SIZE,
+            .sprite = arrow->type - 1,
+            .orientation = arrow->direction + (arrow->flipped ? 4 : 0),
+        };
+    }
+}
+
+// uploads range of count items between the first and the
+// last one which differ from copy of buffer
+static void upload_changed(unsigned int buffer, void *copy, const void *data, size_t count, size_t size, size_t offset) {
+    size_t first = 0, last = count;
+    while (first < count && memcmp((char*)copy + first*size, (const char*)data + first*size, size) == 0) first++;
+    if (first == count) return;
+    while (memcmp((char*)copy + (last - 1)*size, (const char*)data + (last - 1)*size, size) == 0) last--;
+    memcpy((char*)copy + first*size, (const char*)data + first*size, (last - first)*size);
+    rlUpdateVertexBuffer(buffer, (const char*)data + first*size, (last - first)*size, (offset + first)*size);
+}
+
+static void instancer_write(instancer_t *instancer, size_t slot, const instance_t *cells, const Color *colors) {
+    const size_t offset = slot*CHUNK_SIZE*CHUNK_SIZE;
+    upload_changed(instancer->cells, instancer->cell_data + offset, cells, CHUNK_SIZE*CHUNK_SIZE, sizeof(*cells), offset);
+    upload_changed(instancer->colors, instancer->color_data + offset, colors, CHUNK_SIZE*CHUNK_SIZE, sizeof(*colors), offset);
+}
+
+static void instance_visit(renderer_t *renderer, point_t key, chunk_t *chunk, void *context) {
+    instancer_t *instancer = &renderer->instancer;
+    struct InstanceSlot *entry = hmgetp_null(instancer->slots, key);
+    if (entry == NULL) {
+        if (arrlenu(instancer->free_slots) == 0) {
+            instancer->overflow = true;
+            draw_chunk(renderer, key, chunk, context);
+            return;
+        }
+        struct InstanceSlot slot = { .key = key };
+        slot.value.slot = arrpop(instancer->free_slots);
+        hmputs(instancer->slots, slot);
+        entry = hmgetp(instancer->slots, key);
+        chunk->dirty |= DIRTY_INSTANCES;
+    }
+    entry->value.last_used = renderer->frame;
+    if (!(chunk->dirty & DIRTY_INSTANCES)) return;
+    instance_t cells[CHUNK_SIZE*CHUNK_SIZE];
+    Color colors[CHUNK_SIZE*CHUNK_SIZE];
+    chunk_instances(key, chunk, cells, colors);
+    instancer_write(instancer, entry->value.slot, cells, colors);
+    chunk->dirty &= ~DIRTY_INSTANCES;
+}
+
+// empties slots of chunks not drawn this frame, or all of them
+static void instancer_release(renderer_t *renderer, bool everything) {
+    instancer_t *instancer = &renderer->instancer;
+    instance_t cells[CHUNK_SIZE*CHUNK_SIZE];
+    const Color colors[CHUNK_SIZE*CHUNK_SIZE] = { 0 };
+    for (size_t i = 0; i < CHUNK_SIZE*CHUNK_SIZE; i++) {
+        cells[i] = (instance_t){ .sprite = -1 };
+    }
+    point_t *unused = NULL;
+    for (size_t i = 0; i < hmlenu(instancer->slots); i++) {
+        if (everything || instancer->slots[i].value.last_used != renderer->frame) arrput(unused, instancer->slots[i].key);
+    }
+    for (size_t i = 0; i < arrlenu(unused); i++) {
+        const size_t slot = hmgetp(instancer->slots, unused[i])->value.slot;
+        instancer_write(instancer, slot, cells, colors);
+        arrput(instancer->free_slots, slot);
+        (void)hmdel(instancer->slots, unused[i]);
+    }
+    arrfree(unused);
+}
+
+static void instancer_draw(renderer_t *renderer, Texture atlas) {
+    instancer_t *instancer = &renderer->instancer;
+    size_t slots = 0;
+    for (size_t i = 0; i < hmlenu(instancer->slots); i++) {
+        if (instancer->slots[i].value.slot >= slots) slots = instancer->slots[i].value.slot + 1;
+    }
+    if (slots == 0) return;
+    const float screen[2] = { GetScreenWidth(), GetScreenHeight() };
+    const float sprite[2] = { (float)ATLAS_SPRITE_SIZE/atlas.width, (float)ATLAS_SPRITE_SIZE/atlas.height };
+    // whatever raylib batched so far goes first
+    rlDrawRenderBatchActive();
+    rlEnableShader(instancer->shader.id);
+    rlSetUniform(instancer->camera_location, &settings.camera, RL_SHADER_UNIFORM_VEC2, 1);
+    rlSetUniform(instancer->zoom_location, &settings.zoom, RL_SHADER_UNIFORM_FLOAT, 1);
+    rlSetUniform(instancer->screen_location, screen, RL_SHADER_UNIFORM_VEC2, 1);
+    rlSetUniform(instancer->sprite_location, sprite, RL_SHADER_UNIFORM_VEC2, 1);
+    rlActiveTextureSlot(0);
+    rlEnableTexture(atlas.id);
+    rlEnableVertexArray(instancer->vao);
+    rlDrawVertexArrayInstanced(0, 6, slots*CHUNK_SIZE*CHUNK_SIZE);
+    rlDisableVertexArray();
+    rlDisableTexture();
+    rlDisableShader();
+}
+
+static bool range_equal(chunk_range_t a, chunk_range_t b) {
+    return a.min.x == b.min.x && a.min.y == b.min.y && a.max.x == b.max.x && a.max.y == b.max.y;
+}
+
+// visits chunks of map.changed in range, cached imagery of the
+// rest of the screen is up to date
+static void visit_changed(renderer_t *renderer, map_t *map, chunk_range_t range, chunk_visitor_t visit, void *context) {
+    for (size_t i = 0; i < arrlenu(map->changed); i++) {
+        const point_t key = map->changed[i];
+        if (!range_contains(range, key)) continue;
+        struct HashTable *entry = hmgetp_null(map->chunks, key);
+        if (entry != NULL) visit(renderer, key, entry->value, context);
+    }
+}
+
+static bool chunk_has_cells(const chunk_t *chunk) {
+    for (size_t i = 0; i < CHUNK_SIZE*CHUNK_SIZE; i++) {
+        if (chunk->arrows[i].type != Empty) return true;
+    }
+    return false;
+}
+
+// pager_t.tick of the last event, unload_timer grows with the
+// tick since then, idle chunks give one UNLOAD_TIMER_MAX ago
+static uint32_t chunk_last_event(const map_t *map, const chunk_t *chunk) {
+    return map->pager.tick - chunk->unload_timer;
+}
+
+// counts with ticks wrapping around
+static bool tick_after(uint32_t a, uint32_t b) {
+    return (int32_t)(a - b) > 0;
+}
+
+// pixels with events in the last ticks fade from red to orange
+// as chunk calms down, idle ones with cells are gray
+static Color minimap_color(const minimap_t *minimap, size_t pixel, uint32_t tick) {
+    const uint32_t age = tick - minimap->last_event[pixel];
+    if (age >= UNLOAD_TIMER_MAX) return minimap->cells[pixel] ? GRAY : BLANK;
+    const Color fresh = signal_color(SIGNAL_COLOR_RED, minimap->dark);
+    const Color old = signal_color(SIGNAL_COLOR_ORANGE, minimap->dark);
+    const float t = (float)(UNLOAD_TIMER_MAX - 1 - age) / (UNLOAD_TIMER_MAX - 1);
+    return (Color){
+        old.r + (fresh.r - old.r)*t,
+        old.g + (fresh.g - old.g)*t,
+        old.b + (fresh.b - old.b)*t,
+        0xff,
+    };
+}
+
+static size_t minimap_pixel(const minimap_t *minimap, point_t key) {
+    return (size_t)((key.y - minimap->origin.y) / minimap->scale) * minimap->width +
+        (key.x - minimap->origin.x) / minimap->scale;
+}
+
+// walks the whole map, so it's done only when the map
+// grows out of the image or theme changes
+static void minimap_rebuild(minimap_t *minimap, map_t *map) {
+    minimap_free(minimap);
+    minimap->dark = settings.dark_theme;
+    const size_t resident = hmlenu(map->chunks);
+    const size_t count = resident + hmlenu(map->pager.chunks);
+    if (count == 0) return;
+    point_t min = resident > 0 ? map->chunks[0].key : map->pager.chunks[0].key;
+    point_t max = min;
+    for (size_t i = 0; i < count; i++) {
+        const point_t key = i < resident ? map->chunks[i].key : map->pager.chunks[i - resident].key;
+        if (key.x < min.x) min.x = key.x;
+        if (key.y < min.y) min.y = key.y;
+        if (key.x > max.x) max.x = key.x;
+        if (key.y > max.y) max.y = key.y;
+    }
+    const int64_t width = (int64_t)max.x - min.x + 1 + 2*MINIMAP_MARGIN;
+    const int64_t height = (int64_t)max.y - min.y + 1 + 2*MINIMAP_MARGIN;
+    const int64_t side = width > height ? width : height;
+    minimap->scale = (side + MINIMAP_PIXELS - 1) / MINIMAP_PIXELS;
+    minimap->origin = (point_t){ min.x - MINIMAP_MARGIN, min.y - MINIMAP_MARGIN };
+    minimap->width = (width + minimap->scale - 1) / minimap->scale;
+    minimap->height = (height + minimap->scale - 1) / minimap->scale;
+
+    const size_t pixels = (size_t)minimap->width * minimap->height;
+    minimap->last_event = malloc(pixels * sizeof(*minimap->last_event));
+    minimap->cells = calloc(pixels, sizeof(*minimap->cells));
+    minimap->pixels = malloc(pixels * sizeof(*minimap->pixels));
+    assert(minimap->last_event != NULL && minimap->cells != NULL && minimap->pixels != NULL && "No RAM");
+    const uint32_t idle = map->pager.tick - UNLOAD_TIMER_MAX;
+    for (size_t i = 0; i < pixels; i++) {
+        minimap->last_event[i] = idle;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (i >= resident) {
+            // paged out chunks are always idle
+            const struct PagedChunk *paged = &map->pager.chunks[i - resident];
+            minimap->cells[minimap_pixel(minimap, paged->key)] |= paged->value.size > 0;
+            continue;
+        }
+        const size_t pixel = minimap_pixel(minimap, map->chunks[i].key);
+        const chunk_t *chunk = map->chunks[i].value;
+        const uint32_t last_event = chunk_last_event(map, chunk);
+        if (tick_after(last_event, minimap->last_event[pixel])) minimap->last_event[pixel] = last_event;
+        if (!minimap->cells[pixel]) minimap->cells[pixel] = chunk_has_cells(chunk);
+    }
+    for (size_t i = 0; i < pixels; i++) {
+        minimap->pixels[i] = minimap_color(minimap, i, map->pager.tick);
+    }
+    const Image image = {
+        .data = minimap->pixels,
+        .width = minimap->width,
+        .height = minimap->height,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+    };
+    minimap->texture = LoadTextureFromImage(image);
+}
+
+static bool minimap_contains(const minimap_t *minimap, point_t key) {
+    return key.x >= minimap->origin.x && key.y >= minimap->origin.y &&
+        (int64_t)key.x < (int64_t)minimap->origin.x + minimap->width*minimap->scale &&
+        (int64_t)key.y < (int64_t)minimap->origin.y + minimap->height*minimap->scale;
+}
+
+// pixels of chunks in map.changed, every changed chunk only
+// moves aggregate of it's pixel, so other chunks aren't looked up
+static void minimap_update(minimap_t *minimap, map_t *map) {
+    if (minimap->pixels == NULL || minimap->dark != settings.dark_theme) {
+        minimap_rebuild(minimap, map);
+        return;
+    }
+    for (size_t i = 0; i < arrlenu(map->changed); i++) {
+        const point_t key = map->changed[i];
+        if (!minimap_contains(minimap, key)) {
+            minimap_rebuild(minimap, map);
+            return;
+        }
+        struct HashTable *entry = hmgetp_null(map->chunks, key);
+        if (entry == NULL) continue;
+        const size_t pixel = minimap_pixel(minimap, key);
+        const uint32_t last_event = chunk_last_event(map, entry->value);
+        if (tick_after(last_event, minimap->last_event[pixel])) minimap->last_event[pixel] = last_event;
+        // pixel of several chunks can't tell whether the others
+        // still have cells, so it stays gray until image is made again
+        if (minimap->scale == 1 || !minimap->cells[pixel]) minimap->cells[pixel] = chunk_has_cells(entry->value);
+        minimap->pixels[pixel] = minimap_color(minimap, pixel, map->pager.tick);
+        const int y = pixel / minimap->width;
+        if (y < minimap->first_row) minimap->first_row = y;
+        if (y > minimap->last_row) minimap->last_row = y;
+    }
+}
+
+void render_minimap(renderer_t *renderer, Rectangle panel) {
+    minimap_t *minimap = &renderer->minimap;
+    if (minimap->texture.id == 0) return;
+    if (minimap->first_row <= minimap->last_row) {
+        const Rectangle rows = { 0, minimap->first_row, minimap->width, minimap->last_row - minimap->first_row + 1 };
+        UpdateTextureRec(minimap->texture, rows, minimap->pixels + minimap->first_row*minimap->width);
+        minimap->first_row = minimap->height;
+        minimap->last_row = -1;
+    }
+    // pixels per chunk, image is centered in panel
+    const float size = fminf(panel.width / minimap->width, panel.height / minimap->height) / minimap->scale;
+    const Rectangle dest = {
+        .x = panel.x + (panel.width - minimap->width*minimap->scale*size) / 2,
+        .y = panel.y + (panel.height - minimap->height*minimap->scale*size) / 2,
+        .width = minimap->width*minimap->scale*size,
+        .height = minimap->height*minimap->scale*size,
+    };
+    DrawTexturePro(minimap->texture, (Rectangle){ 0, 0, minimap->width, minimap->height }, dest, (Vector2){ 0, 0 }, 0, WHITE);
+
+    const Vector2 mouse = GetMousePosition();
+    if (IsMouseButtonDown(MOUSE_BUTTON_LEFT) && CheckCollisionPointRec(mouse, dest)) {
+        // cell under the mouse goes to the center of the screen
+        const float x = (minimap->origin.x + (mouse.x - dest.x) / size) * CHUNK_SIZE;
+        const float y = (minimap->origin.y + (mouse.y - dest.y) / size) * CHUNK_SIZE;
+        settings.camera.x = x - GetScreenWidth() / settings.zoom / 2;
+        settings.camera.y = y - GetScreenHeight() / settings.zoom / 2;
+    }
+    const Rectangle camera = {
+        .x = dest.x + (settings.camera.x / CHUNK_SIZE - minimap->origin.x) * size,
+        .y = dest.y + (settings.camera.y / CHUNK_SIZE - minimap->origin.y) * size,
+        .width = GetScreenWidth() / settings.zoom / CHUNK_SIZE * size,
+        .height = GetScreenHeight() / settings.zoom / CHUNK_SIZE * size,
+    };
+    BeginScissorMode(dest.x, dest.y, dest.width, dest.height);
+    DrawRectangleLinesEx(camera, 1, settings.dark_theme ? WHITE : BLACK);
+    EndScissorMode();
+}
+
+void render_map(renderer_t *renderer, map_t *map, Texture atlas) {
+    // whole screen is visited once something else than chunks changed
+    bool full = !map->track_changes;
+    if (atlas.id != renderer->atlas_id) {
+        render_clear_cache(renderer);
+        render_clear_regions(renderer);
+        render_type_colors(renderer, atlas);
+        // signal colors depend on theme
+        if (renderer->instancer.shader.id != 0) instancer_release(renderer, true);
+        renderer->atlas_id = atlas.id;
+        full = true;
+    }
+    renderer->frame++;
+    const enum LodTier tier =
+        settings.zoom > INSTANCE_ZOOM && renderer->instancer.shader.id != 0 ? LOD_INSTANCES :
+        settings.zoom >= LOD_CELL_ZOOM ? LOD_SPRITES :
+        settings.zoom >= LOD_CHUNK_ZOOM ? LOD_CELLS : LOD_CHUNKS;
+    // regions of the other tier would have to be rebuilt anyway
+    if (tier != renderer->tier) {
+        render_clear_regions(renderer);
+        renderer->tier = tier;
+        full = true;
+    }
+    const chunk_range_t range = visible_chunks();
+    if (!range_equal(range, renderer->range)) {
+        renderer->range = range;
+        full = true;
+    }
+    if (tier == LOD_INSTANCES) {
+        // chunks which don't get a slot are drawn as sprites every frame
+        sprite_context_t context = { .atlas = atlas };
+        if (full || renderer->instancer.overflow) {
+            renderer->instancer.overflow = false;
+            visit_chunks(renderer, map, range, instance_visit, &context);
+            instancer_release(renderer, false);
+        } else {
+            visit_changed(renderer, map, range, instance_visit, &context);
+        }
+        instancer_draw(renderer, atlas);
+    } else if (tier == LOD_SPRITES) {
+        // every chunk is a few quads anyway
+        sprite_context_t context = { .atlas = atlas };
+        visit_chunks(renderer, map, range, draw_chunk, &context);
+        render_trim_cache(renderer);
+    } else {
+        if (full) visit_chunks(renderer, map, range, lod_visit, map);
+        else visit_changed(renderer, map, range, lod_visit, map);
+        draw_regions(renderer, range);
+        render_trim_regions(renderer);
+    }
+    minimap_update(&renderer->minimap, map);
+    map_clear_changed(map);
+}
+
+#if DEBUG
+void render_debug(const map_t *map) {
+    const chunk_range_t range = visible_chunks();
+    for (size_t i = 0; i < arrlenu(map->debug); i++) {
+        const chunk_debug_t *debug = &map->debug[i];
+        if (debug->thread < 0 || !range_contains(range, debug->key)) continue;
+        const Vector2 origin = chunk_origin(debug->key);
+        // every thread has it's own color
+        const Color color = ColorFromHSV(debug->thread * 47 % 360, 0.7, 0.9);
+        DrawRectangle(origin.x, origin.y, CHUNK_SIZE*settings.zoom, CHUNK_SIZE*settings.zoom, ColorAlpha(color, 0.5));
+        DrawText(TextFormat("%d e%u t%d", debug->unload_timer, debug->events, debug->thread),
+                origin.x, origin.y, CHUNK_SIZE*settings.zoom/6, BLACK);
+    }
+}
+#endif // DEBUG
@@ -0,0 +1,167 @@
+#ifndef RENDER_H
+#define RENDER_H
+#include <stdbool.h>
+#include <stdint.h>
+#include <raylib.h>
+
+#include "map.h"
+
+// atlas has rows of square sprites, type 1 is the first one
+#define ATLAS_SPRITE_SIZE 256
+#define ATLAS_COLUMNS 8
+
+// resolution of cached layouts, in pixels per cell
+#define LAYOUT_CELL_PIXELS 8
+// chunks cached in video memory past the visible ones, so panning
+// doesn't bake everything again, but never more than the max;
+// layout takes 64KB and signals 1KB, so cache is 65MB at most,
+// about 52MB at 1080p where zoom 4 shows ~560 chunks
+#define CHUNK_CACHE_MARGIN 256
+#define CHUNK_CACHE_MAX 1024
+// the rest is drawn cell by cell until later frames
+#define LAYOUT_BAKES_PER_FRAME 64
+
+// above this zoom cached layouts would be magnified, so
+// cells are drawn as instances straight from the atlas
+#define INSTANCE_ZOOM LAYOUT_CELL_PIXELS
+#define INSTANCE_CHUNKS_MAX 256
+
+// below this zoom chunks are drawn one pixel per cell
+#define LOD_CELL_ZOOM 4.0f
+// and below this one pixel per chunk
+#define LOD_CHUNK_ZOOM 0.5f
+// level of detail images are split into square regions
+// of this many pixels per side, 256KB each, 64MB at most
+#define LOD_REGION_PIXELS 256
+#define LOD_REGION_MAX 256
+
+// longer side of minimap image, larger maps have
+// several chunks per pixel
+#define MINIMAP_PIXELS 1024
+// chunks added around the map, so growing map
+// rarely needs the image made again
+#define MINIMAP_MARGIN 32
+
+enum LodTier {
+    LOD_INSTANCES,
+    LOD_SPRITES,
+    LOD_CELLS,
+    LOD_CHUNKS,
+};
+
+// inclusive range of chunk keys
+typedef struct {
+    point_t min, max;
+} chunk_range_t;
+
+typedef struct {
+    // one texel per cell, uploaded once chunk has DIRTY_SIGNALS
+    Texture signals;
+    RenderTexture2D layout;
+    // false until the first bake of layout
+    bool baked;
+    // renderer_t.frame it was last drawn in
+    uint64_t last_used;
+} chunk_cache_t;
+
+typedef struct {
+    Texture texture;
+    // LOD_CHUNKS changes single pixels, so they are
+    // collected here and uploaded once per frame
+    Color *pixels;
+    bool stale;
+    uint64_t last_used;
+} lod_region_t;
+
+// per instance attributes, signal color is in separate buffer
+typedef struct {
+    float x, y;
+    // index in atlas, negative for empty cell
+    float sprite;
+    // direction, plus 4 if flipped
+    float orientation;
+} instance_t;
+
+typedef struct {
+    // id is 0 if shader didn't compile, LOD_SPRITES is used instead
+    Shader shader;
+    int camera_location, zoom_location, screen_location, sprite_location;
+    unsigned int vao, corners, cells, colors;
+    // slot of every visible chunk, slot i is instances from
+    // i*CHUNK_SIZE*CHUNK_SIZE, chunks not drawn in a frame free theirs
+    struct InstanceSlot { point_t key; struct { size_t slot; uint64_t last_used; } value; } *slots;
+    size_t *free_slots;
+    // some visible chunk didn't get a slot in the last frame
+    bool overflow;
+    // what buffers hold, so only changed cells are uploaded
+    instance_t *cell_data;
+    Color *color_data;
+} instancer_t;
+
+// one pixel per chunk colored by how recently it had events,
+// only pixels of chunks in map_t.changed are updated
+typedef struct {
+    // chunk in the top left corner of the image, every
+    // pixel covers scale*scale chunks
+    point_t origin;
+    int width, height, scale;
+    // per pixel, pager_t.tick of the last event in any of it's
+    // chunks and whether any of them has cells
+    uint32_t *last_event;
+    bool *cells;
+    Color *pixels;
+    // id is 0 until first chunk appears
+    Texture texture;
+    // rows changed since last upload, first > last if none
+    int first_row, last_row;
+    // theme pixels were colored with
+    bool dark;
+} minimap_t;
+
+typedef struct {
+    // signals and sprites of chunks prerendered into textures, so
+    // a chunk is two quads, layout is baked again once chunk has
+    // DIRTY_RENDER set
+    struct ChunkCache { point_t key; chunk_cache_t value; } *chunks;
+    instancer_t instancer;
+    // zoomed out map is drawn from images with one pixel per cell
+    // or per chunk, pixels of chunk are updated once it has DIRTY_LOD,
+    // image of a chunk is average of it's cells like the next mip level
+    enum LodTier tier;
+    struct LodRegion { point_t key; lod_region_t value; } *regions;
+    // atlas_type_colors of current atlas
+    Color type_colors[MAX_CELL_TYPES];
+    // atlas layouts were baked with, it changes with theme
+    // and so does signal palette
+    unsigned int atlas_id;
+    // visible chunks in the last frame, while it's the same
+    // only chunks of map_t.changed need updating
+    chunk_range_t range;
+    minimap_t minimap;
+    uint64_t frame;
+} renderer_t;
+
+Color signal_color(enum SignalColor color, bool dark);
+// average color of every sprite weighted by alpha, as if it was
+// mip level of atlas where sprite is one pixel, gray if atlas
+// couldn't be loaded
+void atlas_type_colors(Image atlas, Color colors[MAX_CELL_TYPES]);
+// needs the window to be open
+void render_init(renderer_t *renderer);
+// must be called before the window is closed
+void render_free(renderer_t *renderer);
+// chunks intersecting the screen with current camera and zoom
+chunk_range_t visible_chunks(void);
+// draws only visible chunks, so frame time depends on
+// what's on the screen and not on size of the map, clears
+// map_t.changed which should be tracked
+void render_map(renderer_t *renderer, map_t *map, Texture atlas);
+// draws minimap fitted into panel, clicking or dragging
+// over it moves camera there
+void render_minimap(renderer_t *renderer, Rectangle panel);
+#if DEBUG
+// draws map_t.debug of visible chunks over the map
+void render_debug(const map_t *map);
+#endif // DEBUG
+
+#endif // RENDER_H
@@ -0,0 +1,15 @@
+#ifndef SETTINGS_H
+#define SETTINGS_H
+#include <stdbool.h>
+#include <raylib.h>
+
+typedef struct Settings {
+    bool dark_theme;
+    float tps;
+    Vector2 camera, last_mouse_position;
+    float zoom;
+    bool pause;
+} settings_t;
+extern settings_t settings;
+
+#endif // SETTINGS_H
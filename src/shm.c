@@ -0,0 +1,199 @@
+#include <assert.h>
+#include <sched.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <omp.h>
+
+#include "stb_ds.h"
+#include "map.h"
+#include "shm.h"
+
+// must be power of two
+#define SHM_RING_SIZE (1 << 14)
+#define CACHE_LINE 64
+// sent after the last event of a tick
+#define SHM_TICK_END ((enum QueueType)-1)
+
+// single-producer single-consumer ring of events
+typedef struct {
+    alignas(CACHE_LINE) _Atomic size_t head;
+    alignas(CACHE_LINE) _Atomic size_t tail;
+    alignas(CACHE_LINE) queue_t events[SHM_RING_SIZE];
+} shm_ring_t;
+
+typedef struct {
+    size_t owned_chunks, sent, received;
+    double elapsed;
+    uint64_t checksum;
+} shm_result_t;
+
+typedef struct {
+    int count;
+    // result of every process
+    shm_result_t *results;
+    // ring from process i to process j is rings[i*count + j]
+    shm_ring_t *rings;
+} shm_t;
+
+typedef struct {
+    // events received during this tick
+    queue_t *pending;
+    // peers which already sent SHM_TICK_END this tick
+    bool *finished;
+} shm_inbox_t;
+
+// takes everything peers have sent for current tick so far
+static void shm_receive(shm_t *shm, int rank, shm_inbox_t *inbox) {
+    for (int from = 0; from < shm->count; from++) {
+        if (from == rank || inbox->finished[from]) continue;
+        shm_ring_t *ring = &shm->rings[from*shm->count + rank];
+        size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+        size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        // events after SHM_TICK_END belong to the next tick
+        while (tail != head) {
+            queue_t event = ring->events[tail & (SHM_RING_SIZE - 1)];
+            tail++;
+            if (event.type == SHM_TICK_END) {
+                inbox->finished[from] = true;
+                break;
+            }
+            arrput(inbox->pending, event);
+        }
+        atomic_store_explicit(&ring->tail, tail, memory_order_release);
+    }
+}
+
+static void shm_send(shm_t *shm, int rank, int to, queue_t event, shm_inbox_t *inbox) {
+    shm_ring_t *ring = &shm->rings[rank*shm->count + to];
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    while (head - atomic_load_explicit(&ring->tail, memory_order_acquire) >= SHM_RING_SIZE) {
+        // peer may be stuck sending to us as well
+        shm_receive(shm, rank, inbox);
+        sched_yield();
+    }
+    ring->events[head & (SHM_RING_SIZE - 1)] = event;
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+static void shm_worker(shm_t *shm, map_t *full, const partition_t *partition, int ticks) {
+    const int rank = partition->rank;
+    shm_result_t *result = &shm->results[rank];
+    map_t map = { 0 };
+    map_init(&map);
+    map.partition = partition;
+    for (size_t i = 0; i < hmlenu(full->chunks); i++) {
+        point_t key = full->chunks[i].key;
+        if (partition_owner(partition, key.x) != rank) continue;
+        chunk_t *chunk = map_get_chunk(&map, key.x*CHUNK_SIZE, key.y*CHUNK_SIZE);
+        memcpy(chunk->arrows, full->chunks[i].value->arrows, sizeof(chunk->arrows));
+        chunk->unload_timer = full->chunks[i].value->unload_timer;
+        result->owned_chunks++;
+    }
+
+    shm_inbox_t inbox = { 0 };
+    inbox.finished = calloc(shm->count, sizeof(*inbox.finished));
+    assert(inbox.finished != NULL && "No RAM");
+    double start = omp_get_wtime();
+    for (int tick = 0; tick < ticks; tick++) {
+        map_update(&map);
+        memset(inbox.finished, 0, shm->count*sizeof(*inbox.finished));
+        for (size_t i = 0; i < arrlenu(map.outbox); i++) {
+            queue_t event = map.outbox[i];
+            int to = partition_owner(partition, pos2chunk(event.position.x, event.position.y).x);
+            shm_send(shm, rank, to, event, &inbox);
+        }
+        result->sent += arrlenu(map.outbox);
+        arrsetlen(map.outbox, 0);
+        for (int to = 0; to < shm->count; to++) {
+            if (to == rank) continue;
+            shm_send(shm, rank, to, (queue_t){ .type = SHM_TICK_END }, &inbox);
+        }
+
+        for (;;) {
+            shm_receive(shm, rank, &inbox);
+            int finished = 1;
+            for (int from = 0; from < shm->count; from++) {
+                finished += from != rank && inbox.finished[from];
+            }
+            if (finished == shm->count) break;
+            sched_yield();
+        }
+        map_apply_events(&map, inbox.pending, arrlenu(inbox.pending));
+        result->received += arrlenu(inbox.pending);
+        arrsetlen(inbox.pending, 0);
+    }
+    result->elapsed = omp_get_wtime() - start;
+    result->checksum = map_checksum(&map);
+}
+
+int shm_run(map_t *full, int processes, int ticks) {
+    if (processes < 1) {
+        fprintf(stderr, "Number of processes should be at least 1\n");
+        return 1;
+    }
+    int32_t x_min = INT32_MAX, x_max = INT32_MIN;
+    for (size_t i = 0; i < hmlenu(full->chunks); i++) {
+        if (full->chunks[i].key.x < x_min) x_min = full->chunks[i].key.x;
+        if (full->chunks[i].key.x > x_max) x_max = full->chunks[i].key.x;
+    }
+    if (x_min > x_max) x_min = x_max = 0;
+    int32_t band_width = (x_max - x_min + processes) / processes;
+
+    shm_t shm = { .count = processes };
+    size_t results_size = (processes*sizeof(shm_result_t) + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+    size_t size = results_size + (size_t)processes*processes*sizeof(shm_ring_t);
+    uint8_t *memory = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) {
+        perror("mmap");
+        return 1;
+    }
+    shm.results = (shm_result_t*)memory;
+    shm.rings = (shm_ring_t*)(memory + results_size);
+
+    pid_t *children = calloc(processes, sizeof(*children));
+    assert(children != NULL && "No RAM");
+    for (int rank = 0; rank < processes; rank++) {
+        children[rank] = fork();
+        if (children[rank] < 0) {
+            perror("fork");
+            return 1;
+        }
+        if (children[rank] == 0) {
+            partition_t partition = {
+                .rank = rank, .count = processes,
+                .x_min = x_min, .band_width = band_width,
+            };
+            shm_worker(&shm, full, &partition, ticks);
+            _exit(0);
+        }
+    }
+    int failed = 0;
+    for (int rank = 0; rank < processes; rank++) {
+        int status;
+        waitpid(children[rank], &status, 0);
+        failed |= !WIFEXITED(status) || WEXITSTATUS(status) != 0;
+    }
+    if (failed) {
+        fprintf(stderr, "Some of the processes failed\n");
+        return 1;
+    }
+
+    uint64_t checksum = 0;
+    for (int rank = 0; rank < processes; rank++) {
+        shm_result_t *result = &shm.results[rank];
+        printf("process %d: %zu chunks, %zu events sent, %zu received, %.3f ms/tick\n",
+                rank, result->owned_chunks, result->sent, result->received,
+                result->elapsed / ticks * 1e3);
+        checksum += result->checksum;
+    }
+    printf("checksum: %016llx\n", (unsigned long long)checksum);
+    munmap(memory, size);
+    free(children);
+    return 0;
+}
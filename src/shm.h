@@ -0,0 +1,12 @@
+#ifndef SHM_H
+#define SHM_H
+
+#include "map.h"
+
+// simulates map in `processes` forked processes, every one owns
+// a band of chunk columns and sends events crossing its border
+// to the neighbours through shared memory rings, map must be
+// loaded but not simulated yet, as every process starts from it
+int shm_run(map_t *full, int processes, int ticks);
+
+#endif // SHM_H
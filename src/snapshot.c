@@ -0,0 +1,204 @@
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "stb_ds.h"
+#include "map.h"
+#include "snapshot.h"
+
+#define SNAPSHOT_VERSION 2
+// chunk blocks start at page boundary so they can be used in place
+#define SNAPSHOT_ALIGNMENT 4096
+#define SNAPSHOT_ENDIANNESS 0x01020304u
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    // chunk_t is stored as is, so any change of it's layout
+    // or of host makes old snapshots unusable
+    uint32_t endianness;
+    uint32_t chunk_size, cell_count;
+    uint64_t random_state;
+    uint16_t map_version;
+    uint64_t chunk_count;
+    // map_t.update_queue
+    uint64_t queue_index, queue_count;
+    // file offsets
+    uint64_t entries_offset, chunks_offset, queues_offset;
+} snapshot_header_t;
+
+typedef struct {
+    point_t key;
+    uint32_t queue_count;
+    uint64_t queue_index;
+} snapshot_entry_t;
+
+static bool write_padding(FILE *file, long alignment) {
+    long position = ftell(file);
+    if (position < 0) return false;
+    for (; position % alignment != 0; position++) {
+        if (fputc(0, file) == EOF) return false;
+    }
+    return true;
+}
+
+bool map_snapshot_save(map_t *map, const char *path) {
+    map_apply_edits(map);
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        perror(path);
+        return false;
+    }
+    // paged out chunks are read from pager file and stored as cold chunks
+    const size_t resident = hmlenu(map->chunks);
+    const size_t chunk_count = resident + hmlenu(map->pager.chunks);
+    snapshot_header_t header = {
+        .magic = SNAPSHOT_MAGIC,
+        .version = SNAPSHOT_VERSION,
+        .endianness = SNAPSHOT_ENDIANNESS,
+        .chunk_size = sizeof(chunk_t),
+        .cell_count = CHUNK_SIZE*CHUNK_SIZE,
+        .random_state = map->random_state,
+        .map_version = map->version,
+        .chunk_count = chunk_count,
+        .queue_index = 0,
+        .queue_count = arrlenu(map->update_queue),
+        .entries_offset = sizeof(snapshot_header_t),
+    };
+    size_t chunks_offset = header.entries_offset + chunk_count*sizeof(snapshot_entry_t);
+    header.chunks_offset = (chunks_offset + SNAPSHOT_ALIGNMENT - 1) / SNAPSHOT_ALIGNMENT * SNAPSHOT_ALIGNMENT;
+    header.queues_offset = header.chunks_offset + chunk_count*sizeof(chunk_t);
+
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+    // queues are stored one after another, map queue goes first
+    uint64_t queue_index = header.queue_count;
+    for (size_t i = 0; i < chunk_count && ok; i++) {
+        snapshot_entry_t entry = {
+            .key = i < resident ? map->chunks[i].key : map->pager.chunks[i - resident].key,
+            .queue_count = i < resident ? arrlenu(map->chunks[i].value->update_queue) : 0,
+            .queue_index = queue_index,
+        };
+        queue_index += entry.queue_count;
+        ok = fwrite(&entry, sizeof(entry), 1, file) == 1;
+    }
+    ok = ok && write_padding(file, SNAPSHOT_ALIGNMENT);
+    for (size_t i = 0; i < chunk_count && ok; i++) {
+        chunk_t chunk;
+        if (i < resident) chunk = *map->chunks[i].value;
+        else map_paged_read(map, i - resident, &chunk);
+        // stored as loading process wants them, so load
+        // doesn't have to write into every chunk
+        chunk.update_queue = NULL;
+        chunk.node = 0;
+        chunk.dirty = DIRTY_ALL;
+        chunk.changed = false;
+        ok = fwrite(&chunk, sizeof(chunk), 1, file) == 1;
+    }
+    if (ok && header.queue_count > 0) {
+        ok = fwrite(map->update_queue, sizeof(queue_t), header.queue_count, file) == header.queue_count;
+    }
+    for (size_t i = 0; i < resident && ok; i++) {
+        const size_t count = arrlenu(map->chunks[i].value->update_queue);
+        if (count == 0) continue;
+        ok = fwrite(map->chunks[i].value->update_queue, sizeof(queue_t), count, file) == count;
+    }
+    if (fclose(file) != 0) ok = false;
+    if (!ok) perror(path);
+    return ok;
+}
+
+bool is_snapshot(const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) return false;
+    char magic[sizeof(SNAPSHOT_MAGIC)];
+    bool result = fread(magic, 1, sizeof(magic), file) == sizeof(magic) &&
+        memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) == 0;
+    fclose(file);
+    return result;
+}
+
+bool map_snapshot_load(map_t *map, const char *path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        perror(path);
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(snapshot_header_t)) {
+        fprintf(stderr, "%s: not a snapshot\n", path);
+        close(fd);
+        return false;
+    }
+    const size_t size = st.st_size;
+    // private mapping, so simulation can write to chunks without touching the file
+    uint8_t *data = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        perror(path);
+        return false;
+    }
+
+    const snapshot_header_t *header = (const snapshot_header_t*)data;
+    // offsets are checked before anything is added to them and
+    // counts are divided, so huge values in a corrupted file
+    // can't wrap around and pass
+    const char *error = NULL;
+    if (memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic)) != 0) {
+        error = "not a snapshot";
+    } else if (header->version != SNAPSHOT_VERSION) {
+        error = "unsupported snapshot version";
+    } else if (header->endianness != SNAPSHOT_ENDIANNESS ||
+            header->chunk_size != sizeof(chunk_t) ||
+            header->cell_count != CHUNK_SIZE*CHUNK_SIZE) {
+        error = "snapshot was made by incompatible build";
+    } else if (header->chunks_offset % SNAPSHOT_ALIGNMENT != 0 ||
+            header->entries_offset % _Alignof(snapshot_entry_t) != 0 ||
+            header->queues_offset % _Alignof(queue_t) != 0) {
+        error = "snapshot is corrupted";
+    } else if (header->entries_offset > size || header->chunks_offset > size ||
+            header->queues_offset > size ||
+            header->chunk_count > (size - header->entries_offset) / sizeof(snapshot_entry_t) ||
+            header->chunk_count > (size - header->chunks_offset) / sizeof(chunk_t)) {
+        error = "snapshot is truncated";
+    }
+    const snapshot_entry_t *entries = (const snapshot_entry_t*)(data + header->entries_offset);
+    const queue_t *queues = (const queue_t*)(data + header->queues_offset);
+    const size_t queues_count = error == NULL ? (size - header->queues_offset) / sizeof(queue_t) : 0;
+    if (error == NULL && (header->queue_index > queues_count ||
+                header->queue_count > queues_count - header->queue_index)) {
+        error = "snapshot is truncated";
+    }
+    for (size_t i = 0; i < header->chunk_count && error == NULL; i++) {
+        if (entries[i].queue_index > queues_count ||
+                entries[i].queue_count > queues_count - entries[i].queue_index)
+            error = "snapshot is truncated";
+    }
+    if (error != NULL) {
+        fprintf(stderr, "%s: %s\n", path, error);
+        munmap(data, size);
+        return false;
+    }
+
+    map->version = header->map_version;
+    map->random_state = header->random_state;
+    chunk_t *chunks = (chunk_t*)(data + header->chunks_offset);
+    for (size_t i = 0; i < header->chunk_count; i++) {
+        // save stored chunks ready to use, only chunks with events
+        // are written, the rest stays shared with page cache and
+        // isn't even read until simulation reaches it
+        chunk_t *chunk = &chunks[i];
+        for (size_t q = 0; q < entries[i].queue_count; q++) {
+            arrput(chunk->update_queue, queues[entries[i].queue_index + q]);
+        }
+        map_insert_chunk(map, entries[i].key, chunk);
+    }
+    for (size_t q = 0; q < header->queue_count; q++) {
+        arrput(map->update_queue, queues[header->queue_index + q]);
+    }
+    // mapping lives as long as the chunks
+    return true;
+}
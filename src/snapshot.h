@@ -0,0 +1,18 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+#include <stdbool.h>
+
+#include "map.h"
+
+#define SNAPSHOT_MAGIC "ARWSNAP"
+
+// saves full engine state, pending edits are applied first,
+// must be called between ticks by the thread running map_update
+bool map_snapshot_save(map_t *map, const char *path);
+// map must be freshly initialized, chunks are used right from
+// the mapped file, so cell arrays are never parsed or copied
+bool map_snapshot_load(map_t *map, const char *path);
+// checks whether file starts with SNAPSHOT_MAGIC
+bool is_snapshot(const char *path);
+
+#endif // SNAPSHOT_H
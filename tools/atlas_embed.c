@@ -0,0 +1,81 @@
+// decodes atlases at build time into a header with raw RGBA pixels,
+// so the game uploads them straight from the binary, run by make as
+//   ./build/atlas_embed build/atlas_data.h light atlas.png dark atlas_dark.png
+// every pair of name and png becomes ATLAS_<NAME>_WIDTH,
+// ATLAS_<NAME>_HEIGHT and array atlas_<name>
+#include <ctype.h>
+#include <stdio.h>
+#include <raylib.h>
+
+#include "map.h"
+#include "render.h"
+
+// input bytes per line of string literal
+#define BYTES_PER_LINE 64
+
+// rows of sprites past the last cell type are cut off
+static int atlas_rows(void) {
+    return (MAX_CELL_TYPES - 1 + ATLAS_COLUMNS - 1) / ATLAS_COLUMNS;
+}
+
+// string literal compiles much faster than array of numbers, octal
+// escapes are always 3 digits, so next character can't extend them
+static void write_bytes(FILE *file, const unsigned char *data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        if (i % BYTES_PER_LINE == 0) fputs(i == 0 ? "    \"" : "\"\n    \"", file);
+        const unsigned char c = data[i];
+        if (isprint(c) && c != '"' && c != '\\' && c != '?') fputc(c, file);
+        else fprintf(file, "\\%03o", c);
+    }
+    fputs("\"", file);
+}
+
+static bool write_atlas(FILE *file, const char *name, const char *path) {
+    Image image = LoadImage(path);
+    if (image.data == NULL) {
+        fprintf(stderr, "%s: can't load atlas\n", path);
+        return false;
+    }
+    ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    const int height = atlas_rows() * ATLAS_SPRITE_SIZE;
+    if (image.height > height) ImageCrop(&image, (Rectangle){ 0, 0, image.width, height });
+
+    char upper[64];
+    size_t length = 0;
+    for (; name[length] != '\0' && length < sizeof(upper) - 1; length++) {
+        upper[length] = toupper((unsigned char)name[length]);
+    }
+    upper[length] = '\0';
+    const size_t size = (size_t)image.width * image.height * 4;
+    fprintf(file, "// %s\n", path);
+    fprintf(file, "#define ATLAS_%s_WIDTH %d\n", upper, image.width);
+    fprintf(file, "#define ATLAS_%s_HEIGHT %d\n", upper, image.height);
+    // exact size leaves out terminating zero of the literal
+    fprintf(file, "static const unsigned char atlas_%s[%zu] =\n", name, size);
+    write_bytes(file, image.data, size);
+    fputs(";\n\n", file);
+    UnloadImage(image);
+    return true;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 4 || argc % 2 != 0) {
+        fprintf(stderr, "usage: %s output.h name atlas.png [name atlas.png ...]\n", argv[0]);
+        return 1;
+    }
+    // raylib logs to stdout
+    SetTraceLogLevel(LOG_WARNING);
+    FILE *file = fopen(argv[1], "w");
+    if (file == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+    fputs("// generated by tools/atlas_embed.c, don't edit\n", file);
+    bool ok = true;
+    for (int i = 2; i < argc && ok; i += 2) {
+        ok = write_atlas(file, argv[i], argv[i + 1]);
+    }
+    ok = fclose(file) == 0 && ok;
+    if (!ok) remove(argv[1]);
+    return ok ? 0 : 1;
+}